@@ -0,0 +1,1807 @@
+/* FILE: benchmark.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Time each phase of formatting a TV guide, reading, sorting,
+ *          filtering and output, on input files of different sizes, to show
+ *          where the time goes and how each phase grows with entry count.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: clock_gettime() is POSIX rather than C89, but clock() measures
+ *           CPU time instead of elapsed time, so the POSIX clock is used.
+ *           dup() and dup2() are POSIX as well, and are used to send the
+ *           screen output phase to /dev/null.
+ */
+
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "io.h"
+#include "vector.h"
+#include "sort.h"
+#include "parallelSort.h"
+#include "filter.h"
+#include "comparison.h"
+#include "query.h"
+#include "titleIndex.h"
+#include "trigram.h"
+#include "schedule.h"
+#include "writer.h"
+
+
+/* files the write phases write to, deleted once they have been timed */
+#define BENCH_OUTPUT "bench_output.txt"
+#define BENCH_GUIDE "bench_guide.txt"
+#define BENCH_ASYNC "bench_async.txt"
+
+/* the day entries are filtered to, as given by getDay() */
+#define BENCH_DAY 1
+
+#define FORMAT_TABLE 0
+#define FORMAT_CSV 1
+#define FORMAT_JSON 2
+
+/* room for every field of a row of results */
+#define MAX_FIELDS 64
+
+/* range queries timed on the time index, how many of them are also timed
+ * as a scan of every entry, the most minutes each spans, and the seed
+ * that picks them, so every run times the same queries. The next shows
+ * queries start from the same times, and find BENCH_NEXT shows each */
+#define BENCH_QUERIES 1000
+#define BENCH_SCANS 10
+#define BENCH_SPAN 60
+#define BENCH_QUERY_SEED 2018
+#define BENCH_NEXT 10
+
+/* the most chars of a title the prefix queries search for, the chars the
+ * searches for text in titles look for, and the typos fuzzy searches
+ * allow, with one typo made in the text of each */
+#define BENCH_PREFIX 3
+#define BENCH_SEARCH 6
+#define BENCH_EDITS 1
+
+/* times the guide is formatted with each engine, to average out noise */
+#define BENCH_FORMATS 5
+
+
+/* NAME: BenchResult
+ * PURPOSE: Hold the timings of every phase for one input file.
+ * FIELDS:  [ char* ] filename: the input file timed
+ *          [ int ] entries: the amount of entries in the file
+ *          [ int ] kept: the amount of entries left by the filter
+ *          [ long ] bytes: the size of the input file
+ *          [ unsigned long ] grows: times the vector grew while reading
+ *          [ unsigned long ] poolGrows: times the title pool grew while
+ *          reading
+ *          [ double ] read: seconds readFile() took
+ *          [ double ] mapped: seconds readMappedFile() took
+ *          [ double ] handoff: seconds releaseVector() took, the phase
+ *          that copyToArray() used to be
+ *          [ double ] sortTime: seconds sorting by time took
+ *          [ double ] sortName: seconds sorting by name took
+ *          [ double ] sortRadix: seconds sorting by name with the radix
+ *          engine took
+ *          [ double ] parallelTime: seconds parallelSort() took by time
+ *          [ double ] parallelName: seconds parallelSort() took by name
+ *          [ double ] filter: seconds filter() took
+ *          [ double [] ] kernels: seconds each filter kernel took, indexed
+ *          by FILTER_SCALAR, FILTER_SSE2 and FILTER_AVX2
+ *          [ double ] index: seconds indexDays() took
+ *          [ double ] sortDay: seconds sorting one day's segment by name
+ *          took, after indexDays()
+ *          [ double ] timeIndex: seconds buildTimeIndex() took
+ *          [ double ] query: seconds each queryRange() took on average
+ *          [ double ] scan: seconds each query took on average as a scan of
+ *          every entry instead
+ *          [ double ] next: seconds each queryNext() took on average
+ *          [ double ] select: seconds each selectNext() took on average
+ *          [ double ] titleIndex: seconds buildTitleIndex() took
+ *          [ double ] prefix: seconds each queryPrefix() took on average
+ *          [ double ] prefixScan: seconds each prefix query took on average
+ *          as a scan of every entry, sorted by name, instead
+ *          [ double ] trigramIndex: seconds buildTrigramIndex() took
+ *          [ double ] search: seconds each searchTitles() took on average
+ *          [ double ] searchScan: seconds each search took on average as a
+ *          scan of every entry, sorted by name, instead
+ *          [ double ] fuzzy: seconds each searchTitles() with typos took on
+ *          average
+ *          [ double ] fuzzyScan: the same, as a scan of every entry
+ *          [ double ] scheduleIndex: seconds buildSchedule() took
+ *          [ double ] schedule: seconds each querySchedule() took on average
+ *          [ double ] scheduleScan: seconds each schedule took on average as
+ *          a scan of every entry, sorted by time, instead
+ *          [ double ] output: seconds outputArray() took
+ *          [ double ] write: seconds writeFile() took
+ *          [ double ] guide: seconds writeGuide() took, doing the work of
+ *          both outputArray() and writeFile()
+ *          [ double ] async: seconds writeGuideAsync() took, doing the same
+ *          [ double [] ] formats: seconds formatGuideWith() took on
+ *          average, indexed by PREFIX_SPRINTF and PREFIX_TABLE
+ * REMARKS: Private to this file. */
+
+typedef struct
+{
+    char *filename;
+    int entries;
+    int kept;
+    long bytes;
+    unsigned long grows;
+    unsigned long poolGrows;
+    double read;
+    double mapped;
+    double handoff;
+    double sortTime;
+    double sortName;
+    double sortRadix;
+    double parallelTime;
+    double parallelName;
+    double filter;
+    double kernels[FILTER_AVX2 + 1];
+    double index;
+    double sortDay;
+    double timeIndex;
+    double query;
+    double scan;
+    double next;
+    double select;
+    double titleIndex;
+    double prefix;
+    double prefixScan;
+    double trigramIndex;
+    double search;
+    double searchScan;
+    double fuzzy;
+    double fuzzyScan;
+    double scheduleIndex;
+    double schedule;
+    double scheduleScan;
+    double output;
+    double write;
+    double guide;
+    double async;
+    double formats[PREFIX_TABLE + 1];
+} BenchResult;
+
+
+/* NAME: BenchField
+ * PURPOSE: Hold one field of a row of results, for csv and json output.
+ * FIELDS:  [ const char* ] name: the field's column name
+ *          [ double ] value: the field's value
+ *          [ int ] decimals: the decimal places to output the value with
+ * REMARKS: Private to this file. */
+
+typedef struct
+{
+    const char *name;
+    double value;
+    int decimals;
+} BenchField;
+
+
+static double elapsedSeconds( struct timespec *start, struct timespec *end );
+static int benchFile( char filename[], int threads, BenchResult *result );
+static int benchPhases( TVEntry *array, int arraySize, TitlePool *titles,
+                            int threads, BenchResult *result );
+static int benchSorts( TVEntry *array, TVEntry *unsorted, TVEntry *check,
+                        int arraySize, TitlePool *titles, int threads,
+                        BenchResult *result );
+static int benchFilters( TVEntry *array, TVEntry *check, int arraySize,
+                            BenchResult *result );
+static int benchDayIndex( TVEntry *filtered, TVEntry *unsorted,
+                            TVEntry *check, int arraySize,
+                            BenchResult *result );
+static int benchQueries( TVEntry *unsorted, TVEntry *check, int arraySize,
+                            BenchResult *result );
+static int scanRange( const TVEntry *array, int arraySize,
+                        unsigned int from, unsigned int to,
+                        Vector *results );
+static int benchNext( TimeIndex *index, TVEntry *unsorted, int arraySize,
+                        unsigned int from[], BenchResult *result );
+static int benchTitles( TVEntry *unsorted, int arraySize, TitlePool *titles,
+                            BenchResult *result );
+static int benchSchedule( TVEntry *unsorted, int arraySize,
+                            TitlePool *titles, BenchResult *result );
+static int benchSearch( TitleIndex *index, TVEntry *unsorted, int arraySize,
+                            BenchResult *result );
+static int timeSearches( TrigramIndex *index, TVEntry *unsorted,
+                            int arraySize, char text[][BENCH_SEARCH + 1],
+                            int edits, double *search, double *scan,
+                            BenchResult *result );
+static void copyEntries( TVEntry *to, TVEntry *from, int arraySize );
+static int sameOrder( TVEntry *expected, TVEntry *sorted, int arraySize,
+                        const char *engine, BenchResult *result );
+static int benchFormats( TVEntry *array, int arraySize, TitlePool *titles,
+                            BenchResult *result );
+static int sameFiles( const char *expected, const char *written,
+                        BenchResult *result );
+static int silenceOutput( void );
+static void restoreOutput( int saved );
+static double rate( double amount, double seconds );
+static void printHeader( int format );
+static void printResult( BenchResult *result, int format, int first );
+static int resultFields( BenchResult *result, BenchField fields[] );
+static void setField( BenchField *field, const char *name, double value,
+                        int decimals );
+static void printFooter( int format );
+
+
+
+
+/* NAME: main
+ * PURPOSE: Time every phase on each input file given on the command line.
+ * IMPORTS: [ int ] argc: amount of input CL arguments
+ *          [ char* [] ] argv: CL arguments, optionally -j and a thread
+ *          count for readMappedFile() and parallelSort(), and -f with
+ *          table, csv or json for the output format, then each input file
+ *          to time
+ * EXPORTS: [ int ] status: success or failure of program
+ *          0 is used for success, 1 is used for all errors.
+ * ASSERTIONS
+ *  PRE: Each argument is a TV guide file in the format readFile() accepts.
+ *  POST: One row per file is output, with the time each phase took and the
+ *        throughput of reading, sorting and writing.
+ * REMARKS: If a phase is linear, its per entry time stays roughly the same
+ *          as the file size grows. csv and json are for keeping results to
+ *          compare between changes. */
+
+int main( int argc, char *argv[] )
+{
+    int status = 0, ii = 1, threads = 1, format = FORMAT_TABLE, first = TRUE;
+    BenchResult result;
+
+    /* options come before the files */
+    while ( ( ii + 1 < argc ) && ( argv[ii][0] == '-' ) && ( status == 0 ) )
+    {
+        if ( strcmp( argv[ii], "-j" ) == 0 )
+        {
+            threads = atoi( argv[ii + 1] );
+        }
+        else if ( ( strcmp( argv[ii], "-f" ) == 0 ) &&
+                    ( strcmp( argv[ii + 1], "table" ) == 0 ) )
+        {
+            format = FORMAT_TABLE;
+        }
+        else if ( ( strcmp( argv[ii], "-f" ) == 0 ) &&
+                    ( strcmp( argv[ii + 1], "csv" ) == 0 ) )
+        {
+            format = FORMAT_CSV;
+        }
+        else if ( ( strcmp( argv[ii], "-f" ) == 0 ) &&
+                    ( strcmp( argv[ii + 1], "json" ) == 0 ) )
+        {
+            format = FORMAT_JSON;
+        }
+        else
+        {
+            status = 1;
+        }
+        ii += 2;
+    }
+
+    if ( ( argc <= ii ) || ( threads < 1 ) || ( status != 0 ) )
+    {
+        fprintf( stderr, "Error: Enter at least 1 input file to time.  \n"
+            "Example: ./Benchmark [-j threads] [-f table|csv|json] "
+            "bench_1000.txt bench_100000.txt \n" );
+        status = 1;
+    }
+    else
+    {
+        printHeader( format );
+
+        /* time each file in turn, stopping on the first failure */
+        for ( ; ( ii < argc ) && ( status == 0 ); ii++ )
+        {
+            result.filename = argv[ii];
+            if ( benchFile( argv[ii], threads, &result ) )
+            {
+                printResult( &result, format, first );
+                first = FALSE;
+            }
+            else
+            {
+                status = 1;
+            }
+        }
+
+        printFooter( format );
+    }
+    return status;
+}
+
+
+
+
+/* NAME: elapsedSeconds
+ * PURPOSE: Get the time between two clock readings in seconds.
+ * IMPORTS: [ struct timespec* ] start: the earlier clock reading
+ *          [ struct timespec* ] end: the later clock reading
+ * EXPORTS: [ double ] seconds: time elapsed between the two readings
+ * ASSERTIONS
+ *  PRE: start was read before end.
+ *  POST: seconds is greater than or equal to 0.
+ * REMARKS: None */
+
+double elapsedSeconds( struct timespec *start, struct timespec *end )
+{
+    return ( double )( end->tv_sec - start->tv_sec ) +
+                ( double )( end->tv_nsec - start->tv_nsec ) / 1e9;
+}
+
+
+
+
+/* NAME: benchFile
+ * PURPOSE: Read a file into a vector, time every phase on its entries, then
+ *          memory map and parse it as well.
+ * IMPORTS: [ char [] ] filename: file to read from
+ *          [ int ] threads: the amount of threads readMappedFile() and
+ *          parallelSort() use
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: filename is a valid TV guide file.
+ *  POST: result holds the timings, and everything allocated is freed OR
+ *        an appropriate error is output.
+ * REMARKS: Each phase is given the same entries the program would give it,
+ *          so the timings add up to a whole run of the program. */
+
+int benchFile( char filename[], int threads, BenchResult *result )
+{
+    int success, arraySize;
+    struct timespec start, end;
+    MappedGuide guide;
+    TitlePool titles;
+    Vector vector;
+    TVEntry *array;
+
+    initTitlePool( &titles );
+    initVector( &vector, sizeof ( TVEntry ) );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = readFile( filename, &vector, &titles, 0 );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->read = elapsedSeconds( &start, &end );
+    result->entries = vector.length;
+    result->grows = vector.grows;
+    result->poolGrows = titles.grows;
+
+    if ( success )
+    {
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        arraySize = vector.length;
+        array = ( TVEntry* )releaseVector( &vector );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->handoff = elapsedSeconds( &start, &end );
+
+        success = benchPhases( array, arraySize, &titles, threads, result );
+        free( array );
+    }
+
+    freeVector( &vector );
+    freeTitlePool( &titles );
+
+    if ( success )
+    {
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        success = readMappedFile( filename, &guide, threads, 0 );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->mapped = elapsedSeconds( &start, &end );
+        if ( success )
+        {
+            result->bytes = guide.textSize;
+            freeMappedGuide( &guide );
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: benchPhases
+ * PURPOSE: Time sorting, filtering and output of an array of entries.
+ * IMPORTS: [ TVEntry* ] array: the entries read, in file order
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are in
+ *          [ int ] threads: the amount of threads parallelSort() uses
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: result holds the timings, and array has been sorted and filtered
+ *        OR an appropriate error is output.
+ * REMARKS: Every sort starts from file order, as the program's would, so a
+ *          copy of the unsorted array is kept for the later sorts. */
+
+int benchPhases( TVEntry *array, int arraySize, TitlePool *titles,
+                    int threads, BenchResult *result )
+{
+    int success = TRUE, saved;
+    struct timespec start, end;
+    TVEntry *unsorted, *check;
+
+    unsorted = ( TVEntry* )malloc( ( size_t )( arraySize + 1 ) *
+                                    sizeof ( TVEntry ) );
+    check = ( TVEntry* )malloc( ( size_t )( arraySize + 1 ) *
+                                    sizeof ( TVEntry ) );
+    if ( ( unsorted == NULL ) || ( check == NULL ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        copyEntries( unsorted, array, arraySize );
+        success = benchSorts( array, unsorted, check, arraySize, titles,
+                                threads, result );
+    }
+
+    if ( success )
+    {
+        success = benchFilters( array, check, arraySize, result );
+    }
+
+    if ( success )
+    {
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        result->kept = filter( array, BENCH_DAY, arraySize );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->filter = elapsedSeconds( &start, &end );
+
+        success = ( benchDayIndex( array, unsorted, check, arraySize,
+                                    result ) ) &&
+                    ( benchQueries( unsorted, check, arraySize, result ) ) &&
+                    ( benchTitles( unsorted, arraySize, titles, result ) ) &&
+                    ( benchSchedule( unsorted, arraySize, titles, result ) );
+    }
+    free( unsorted );
+    free( check );
+
+    if ( success )
+    {
+
+        /* the screen output is timed, but not shown */
+        saved = silenceOutput( );
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        outputArray( array, result->kept, titles );
+        fflush( stdout );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        restoreOutput( saved );
+        result->output = elapsedSeconds( &start, &end );
+
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        success = writeFile( BENCH_OUTPUT, array, result->kept, titles );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->write = elapsedSeconds( &start, &end );
+
+        /* the same output again, formatted once for both */
+        saved = silenceOutput( );
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        success = ( success ) && ( writeGuide( BENCH_GUIDE, array,
+                                                result->kept, titles,
+                                                EMPTY_DAY ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        restoreOutput( saved );
+        result->guide = elapsedSeconds( &start, &end );
+
+        /* and again, written by the sinks' threads as it is formatted */
+        saved = silenceOutput( );
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        success = ( success ) && ( writeGuideAsync( BENCH_ASYNC, array,
+                                                    result->kept, titles,
+                                                    EMPTY_DAY ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        restoreOutput( saved );
+        result->async = elapsedSeconds( &start, &end );
+
+        success = ( success ) &&
+                    ( sameFiles( BENCH_OUTPUT, BENCH_GUIDE, result ) ) &&
+                    ( sameFiles( BENCH_OUTPUT, BENCH_ASYNC, result ) ) &&
+                    ( benchFormats( array, result->kept, titles, result ) );
+        remove( BENCH_OUTPUT );
+        remove( BENCH_GUIDE );
+        remove( BENCH_ASYNC );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: benchSorts
+ * PURPOSE: Time every sort engine, and check each gives the same order as
+ *          the one the program uses by default.
+ * IMPORTS: [ TVEntry* ] array: where the entries sorted by name are left
+ *          [ TVEntry* ] unsorted: the entries read, in file order
+ *          [ TVEntry* ] check: room for arraySize entries, for the engines
+ *          being checked to sort
+ *          [ int ] arraySize: the size of the arrays passed
+ *          [ TitlePool* ] titles: the pool the titles of the entries are in
+ *          [ int ] threads: the amount of threads parallelSort() uses
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the arrays.
+ *  POST: result holds the timings and array is sorted by name with qsort()
+ *        OR an appropriate error is output.
+ * REMARKS: The repo has no unit tests, so this is where the engines are
+ *          checked to be equivalent. An engine giving any difference in
+ *          order is an error. */
+
+int benchSorts( TVEntry *array, TVEntry *unsorted, TVEntry *check,
+                    int arraySize, TitlePool *titles, int threads,
+                    BenchResult *result )
+{
+    int success;
+    struct timespec start, end;
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = sortByTime( array, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->sortTime = elapsedSeconds( &start, &end );
+
+    copyEntries( check, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = ( success ) &&
+        ( parallelSort( check, arraySize, &compareByTime, threads ) );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->parallelTime = elapsedSeconds( &start, &end );
+    success = ( success ) && ( sameOrder( array, check, arraySize,
+                                "parallelSort() by time", result ) );
+
+    /* ranking the titles is part of sorting by name */
+    copyEntries( array, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    if ( ( success ) && ( rankTitles( titles, RANK_QSORT ) ) &&
+            ( arraySize > 0 ) )
+    {
+        setTitleRank( titles->rank );
+        qsort( ( void* )array, arraySize, sizeof ( TVEntry ),
+                    &compareByName );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->sortName = elapsedSeconds( &start, &end );
+    success = ( success ) && ( titles->rank != NULL );
+
+    /* the ranks from qsort() are still set for compareByName() */
+    copyEntries( check, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = ( success ) &&
+        ( parallelSort( check, arraySize, &compareByName, threads ) );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->parallelName = elapsedSeconds( &start, &end );
+    success = ( success ) && ( sameOrder( array, check, arraySize,
+                                "parallelSort() by name", result ) );
+
+    copyEntries( check, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = ( success ) && ( rankTitles( titles, RANK_RADIX ) ) &&
+                ( sortByRank( check, arraySize, titles->rank,
+                                titles->count ) );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->sortRadix = elapsedSeconds( &start, &end );
+    success = ( success ) && ( sameOrder( array, check, arraySize,
+                                "Radix sort", result ) );
+
+    /* ranking again freed the ranks compareByName() had, but the new ones
+     * are in the same order, so it is given those for later phases */
+    setTitleRank( titles->rank );
+
+    return success;
+}
+
+
+
+
+/* NAME: benchFilters
+ * PURPOSE: Time each filter kernel the CPU supports, and check they all
+ *          keep the same entries.
+ * IMPORTS: [ TVEntry* ] array: the entries to filter, left unchanged
+ *          [ TVEntry* ] check: room for arraySize entries to filter
+ *          [ int ] arraySize: the size of array
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: result holds the timings, 0 for kernels the CPU does not support,
+ *        OR an appropriate error is output.
+ * REMARKS: The scalar kernel goes first, and the others are checked
+ *          against what it kept, which is still at the front of array. */
+
+int benchFilters( TVEntry *array, TVEntry *check, int arraySize,
+                    BenchResult *result )
+{
+    int success = TRUE, kernel, kept, expected = 0;
+    struct timespec start, end;
+    TVEntry *scalar;
+
+    scalar = ( TVEntry* )malloc( ( size_t )( arraySize + 1 ) *
+                                    sizeof ( TVEntry ) );
+    if ( scalar == NULL )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+
+    for ( kernel = FILTER_SCALAR; kernel <= FILTER_AVX2; kernel++ )
+    {
+        result->kernels[kernel] = 0.0;
+    }
+
+    for ( kernel = FILTER_SCALAR;
+            ( kernel <= bestFilterKernel( ) ) && ( success ); kernel++ )
+    {
+        copyEntries( check, array, arraySize );
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        kept = filterWith( check, BENCH_DAY, arraySize, kernel );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->kernels[kernel] = elapsedSeconds( &start, &end );
+
+        if ( kernel == FILTER_SCALAR )
+        {
+            expected = kept;
+            copyEntries( scalar, check, kept );
+        }
+        else if ( ( kept != expected ) ||
+                    ( !sameOrder( scalar, check, kept, "Filter kernel",
+                                    result ) ) )
+        {
+            fprintf( stderr, "Error: Filter kernel %d kept different "
+                "entries to the scalar kernel in %s\n", kernel,
+                result->filename );
+            success = FALSE;
+        }
+    }
+
+    free( scalar );
+    return success;
+}
+
+
+
+
+/* NAME: benchDayIndex
+ * PURPOSE: Time indexing entries by day, and sorting only one day's
+ *          segment, which together replace sorting and filtering them all.
+ * IMPORTS: [ TVEntry* ] filtered: the entries sorted by name then filtered
+ *          to BENCH_DAY
+ *          [ TVEntry* ] unsorted: the entries read, in file order
+ *          [ TVEntry* ] check: room for arraySize entries to index
+ *          [ int ] arraySize: the size of unsorted
+ *          [ BenchResult* ] result: where to store the timings, with kept
+ *          set to the size of filtered
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: The titles are still ranked for compareByName().
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: The sorted segment must be exactly the filtered entries. */
+
+int benchDayIndex( TVEntry *filtered, TVEntry *unsorted, TVEntry *check,
+                    int arraySize, BenchResult *result )
+{
+    int success, length;
+    struct timespec start, end;
+    DayIndex index;
+    TVEntry *segment;
+
+    copyEntries( check, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = indexDays( check, arraySize, &index );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->index = elapsedSeconds( &start, &end );
+
+    if ( success )
+    {
+        segment = daySegment( check, &index, BENCH_DAY, &length );
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        if ( length > 0 )
+        {
+            qsort( ( void* )segment, length, sizeof ( TVEntry ),
+                        &compareByName );
+        }
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->sortDay = elapsedSeconds( &start, &end );
+
+        success = ( length == result->kept ) &&
+                    ( sameOrder( filtered, segment, length,
+                                    "Day index", result ) );
+        if ( length != result->kept )
+        {
+            fprintf( stderr, "Error: Day index holds %d entries, filter() "
+                "kept %d in %s\n", length, result->kept, result->filename );
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: benchQueries
+ * PURPOSE: Time range queries on a time index, against finding the same
+ *          entries by scanning them all, and check both find the same.
+ * IMPORTS: [ TVEntry* ] unsorted: the entries read, in file order
+ *          [ TVEntry* ] check: room for arraySize entries to index
+ *          [ int ] arraySize: the size of unsorted
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: Only the first BENCH_SCANS queries are scanned, as each scan
+ *          reads every entry. Some queries run on from sunday into monday,
+ *          so the wrap around is checked as well. */
+
+int benchQueries( TVEntry *unsorted, TVEntry *check, int arraySize,
+                    BenchResult *result )
+{
+    int success, ii;
+    unsigned int from[BENCH_QUERIES], to[BENCH_QUERIES];
+    struct timespec start, end;
+    TimeIndex index;
+    Vector found, scanned;
+
+    initVector( &found, sizeof ( TVEntry ) );
+    initVector( &scanned, sizeof ( TVEntry ) );
+
+    srand( BENCH_QUERY_SEED );
+    for ( ii = 0; ii < BENCH_QUERIES; ii++ )
+    {
+        from[ii] = rand( ) % MINUTES_PER_WEEK;
+        to[ii] = ( from[ii] + 1 + rand( ) % BENCH_SPAN ) % MINUTES_PER_WEEK;
+    }
+
+    copyEntries( check, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = buildTimeIndex( &index, check, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->timeIndex = elapsedSeconds( &start, &end );
+
+    /* the results are emptied without being freed, so each query reuses
+     * the memory of the last */
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( ii = 0; ( ii < BENCH_QUERIES ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        success = queryRange( &index, from[ii], to[ii], &found );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->query = elapsedSeconds( &start, &end ) / BENCH_QUERIES;
+
+    result->scan = 0.0;
+    for ( ii = 0; ( ii < BENCH_SCANS ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        scanned.length = 0;
+        success = queryRange( &index, from[ii], to[ii], &found );
+
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        success = ( success ) && ( scanRange( check, arraySize, from[ii],
+                                                to[ii], &scanned ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->scan += elapsedSeconds( &start, &end ) / BENCH_SCANS;
+
+        if ( ( success ) && ( found.length != scanned.length ) )
+        {
+            fprintf( stderr, "Error: Range query found %d entries, a scan "
+                "found %d in %s\n", found.length, scanned.length,
+                result->filename );
+            success = FALSE;
+        }
+        success = ( success ) && ( sameOrder( ( TVEntry* )scanned.data,
+                        ( TVEntry* )found.data, found.length, "Range query",
+                        result ) );
+    }
+
+    freeVector( &found );
+    freeVector( &scanned );
+
+    return ( success ) &&
+            ( benchNext( &index, unsorted, arraySize, from, result ) );
+}
+
+
+
+
+/* NAME: benchNext
+ * PURPOSE: Time finding the next shows from a time on the time index,
+ *          against selecting them from the unindexed entries, and check
+ *          both find the same.
+ * IMPORTS: [ TimeIndex* ] index: the entries, indexed by time
+ *          [ TVEntry* ] unsorted: the same entries, in file order
+ *          [ int ] arraySize: the size of unsorted
+ *          [ unsigned int [] ] from: BENCH_QUERIES minutes of the week to
+ *          find the next shows from
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: index was built from the entries of unsorted.
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: As with the scans, only the first BENCH_SCANS queries are timed
+ *          with selectNext(), as each reads every entry. */
+
+int benchNext( TimeIndex *index, TVEntry *unsorted, int arraySize,
+                unsigned int from[], BenchResult *result )
+{
+    int success = TRUE, ii;
+    struct timespec start, end;
+    Vector found, selected;
+
+    initVector( &found, sizeof ( TVEntry ) );
+    initVector( &selected, sizeof ( TVEntry ) );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( ii = 0; ( ii < BENCH_QUERIES ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        success = queryNext( index, from[ii], BENCH_NEXT, &found );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->next = elapsedSeconds( &start, &end ) / BENCH_QUERIES;
+
+    result->select = 0.0;
+    for ( ii = 0; ( ii < BENCH_SCANS ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        selected.length = 0;
+        success = queryNext( index, from[ii], BENCH_NEXT, &found );
+
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        success = ( success ) && ( selectNext( unsorted, arraySize,
+                                    from[ii], BENCH_NEXT, &selected ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->select += elapsedSeconds( &start, &end ) / BENCH_SCANS;
+
+        if ( ( success ) && ( found.length != selected.length ) )
+        {
+            fprintf( stderr, "Error: Next shows query found %d entries, "
+                "selecting found %d in %s\n", found.length, selected.length,
+                result->filename );
+            success = FALSE;
+        }
+        success = ( success ) && ( sameOrder( ( TVEntry* )found.data,
+                        ( TVEntry* )selected.data, found.length,
+                        "Next shows selection", result ) );
+    }
+
+    freeVector( &found );
+    freeVector( &selected );
+    return success;
+}
+
+
+
+
+/* NAME: benchTitles
+ * PURPOSE: Time prefix queries on a title index, against finding the same
+ *          entries by scanning them all and sorting them by name, and check
+ *          both find the same.
+ * IMPORTS: [ TVEntry* ] unsorted: the entries read, in file order
+ *          [ int ] arraySize: the size of unsorted
+ *          [ TitlePool* ] titles: the pool the titles of unsorted are in
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: Each prefix is the start of a random entry's title, so every
+ *          query finds at least one entry. As with the range queries, only
+ *          the first BENCH_SCANS are scanned. */
+
+int benchTitles( TVEntry *unsorted, int arraySize, TitlePool *titles,
+                    BenchResult *result )
+{
+    int success, ii, length;
+    unsigned int id;
+    char prefix[BENCH_QUERIES][BENCH_PREFIX + 1];
+    struct timespec start, end;
+    TitleIndex index;
+    Vector found, scanned;
+    TVEntry *entry;
+
+    initVector( &found, sizeof ( TVEntry ) );
+    initVector( &scanned, sizeof ( TVEntry ) );
+
+    srand( BENCH_QUERY_SEED );
+    for ( ii = 0; ii < BENCH_QUERIES; ii++ )
+    {
+        length = 0;
+        if ( arraySize > 0 )
+        {
+            id = unsorted[rand( ) % arraySize].title;
+            length = 1 + rand( ) % BENCH_PREFIX;
+            if ( length > getTitleLength( titles, id ) )
+            {
+                length = getTitleLength( titles, id );
+            }
+            memcpy( prefix[ii], getTitle( titles, id ), ( size_t )length );
+        }
+        prefix[ii][length] = '\0';
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = buildTitleIndex( &index, titles, unsorted, arraySize,
+                                RANK_RADIX );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->titleIndex = elapsedSeconds( &start, &end );
+
+    /* building the index ranked the titles again, freeing the ranks
+     * compareByName() had */
+    setTitleRank( titles->rank );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( ii = 0; ( ii < BENCH_QUERIES ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        success = queryPrefix( &index, prefix[ii], &found );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->prefix = elapsedSeconds( &start, &end ) / BENCH_QUERIES;
+
+    result->prefixScan = 0.0;
+    for ( ii = 0; ( ii < BENCH_SCANS ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        scanned.length = 0;
+        success = queryPrefix( &index, prefix[ii], &found );
+        length = strlen( prefix[ii] );
+
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        for ( entry = unsorted; ( entry < unsorted + arraySize ) &&
+                ( success ); entry++ )
+        {
+            if ( comparePrefix( getTitle( titles, entry->title ), prefix[ii],
+                                    length ) == 0 )
+            {
+                success = pushVector( &scanned, entry );
+            }
+        }
+        success = ( success ) &&
+            ( sortByTime( ( TVEntry* )scanned.data, scanned.length ) ) &&
+            ( sortByRank( ( TVEntry* )scanned.data, scanned.length,
+                            titles->rank, index.count ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->prefixScan += elapsedSeconds( &start, &end ) / BENCH_SCANS;
+
+        if ( ( success ) && ( found.length != scanned.length ) )
+        {
+            fprintf( stderr, "Error: Prefix query found %d entries, a scan "
+                "found %d in %s\n", found.length, scanned.length,
+                result->filename );
+            success = FALSE;
+        }
+        success = ( success ) && ( sameOrder( ( TVEntry* )scanned.data,
+                        ( TVEntry* )found.data, found.length, "Prefix query",
+                        result ) );
+    }
+
+    freeVector( &found );
+    freeVector( &scanned );
+
+    success = ( success ) &&
+                ( benchSearch( &index, unsorted, arraySize, result ) );
+    freeTitleIndex( &index );
+    return success;
+}
+
+
+
+
+/* NAME: benchSchedule
+ * PURPOSE: Time looking up the schedules of shows in a schedule, against
+ *          finding the same airings by scanning every entry, and check both
+ *          find the same.
+ * IMPORTS: [ TVEntry* ] unsorted: the entries read, in file order
+ *          [ int ] arraySize: the size of unsorted
+ *          [ TitlePool* ] titles: the pool the titles of unsorted are in
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: Each show is a random entry's title in upper case, so every
+ *          lookup finds at least one airing, and ignores case to do it.
+ *          Only the keys are checked, as the schedule gives every airing
+ *          the show's first title, which a scan does not. */
+
+int benchSchedule( TVEntry *unsorted, int arraySize, TitlePool *titles,
+                    BenchResult *result )
+{
+    int success, ii, jj, length;
+    unsigned int id;
+    char show[BENCH_QUERIES][NAME_SIZE];
+    struct timespec start, end;
+    Schedule schedule;
+    Vector found, scanned;
+    TVEntry *entry;
+
+    initVector( &found, sizeof ( TVEntry ) );
+    initVector( &scanned, sizeof ( TVEntry ) );
+
+    srand( BENCH_QUERY_SEED );
+    for ( ii = 0; ii < BENCH_QUERIES; ii++ )
+    {
+        length = 0;
+        if ( arraySize > 0 )
+        {
+            id = unsorted[rand( ) % arraySize].title;
+            length = getTitleLength( titles, id );
+            if ( length > NAME_SIZE - 1 )
+            {
+                length = NAME_SIZE - 1;
+            }
+            for ( jj = 0; jj < length; jj++ )
+            {
+                show[ii][jj] = toupper( getTitle( titles, id )[jj] );
+            }
+        }
+        show[ii][length] = '\0';
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    success = buildSchedule( &schedule, titles, unsorted, arraySize );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->scheduleIndex = elapsedSeconds( &start, &end );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( ii = 0; ( ii < BENCH_QUERIES ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        success = querySchedule( &schedule, show[ii], &found );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->schedule = elapsedSeconds( &start, &end ) / BENCH_QUERIES;
+
+    result->scheduleScan = 0.0;
+    for ( ii = 0; ( ii < BENCH_SCANS ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        scanned.length = 0;
+        success = querySchedule( &schedule, show[ii], &found );
+        length = strlen( show[ii] );
+
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        for ( entry = unsorted; ( entry < unsorted + arraySize ) &&
+                ( success ); entry++ )
+        {
+            if ( ( getTitleLength( titles, entry->title ) == length ) &&
+                    ( comparePrefix( getTitle( titles, entry->title ),
+                                        show[ii], length ) == 0 ) )
+            {
+                success = pushVector( &scanned, entry );
+            }
+        }
+        success = ( success ) &&
+            ( sortByTime( ( TVEntry* )scanned.data, scanned.length ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->scheduleScan += elapsedSeconds( &start, &end ) / BENCH_SCANS;
+
+        if ( ( success ) && ( found.length != scanned.length ) )
+        {
+            fprintf( stderr, "Error: Schedule found %d entries, a scan "
+                "found %d in %s\n", found.length, scanned.length,
+                result->filename );
+            success = FALSE;
+        }
+        for ( jj = 0; ( jj < found.length ) && ( success ); jj++ )
+        {
+            if ( ( ( TVEntry* )found.data )[jj].key !=
+                    ( ( TVEntry* )scanned.data )[jj].key )
+            {
+                fprintf( stderr, "Error: Schedule order differs from a scan "
+                    "in %s\n", result->filename );
+                success = FALSE;
+            }
+        }
+    }
+
+    freeSchedule( &schedule );
+    freeVector( &found );
+    freeVector( &scanned );
+    return success;
+}
+
+
+
+/* NAME: benchSearch
+ * PURPOSE: Time searching titles for text on a trigram index, exactly and
+ *          with typos, against scanning every entry instead, and check both
+ *          find the same.
+ * IMPORTS: [ TitleIndex* ] index: the entries, indexed by title
+ *          [ TVEntry* ] unsorted: the same entries, in file order
+ *          [ int ] arraySize: the size of unsorted
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: index was built from the entries of unsorted.
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: Each text is from the middle of a random entry's title, so
+ *          every search finds at least one entry. The fuzzy searches use
+ *          the same texts with a char changed. */
+
+int benchSearch( TitleIndex *index, TVEntry *unsorted, int arraySize,
+                    BenchResult *result )
+{
+    int success, ii, start, length;
+    unsigned int id;
+    char text[BENCH_QUERIES][BENCH_SEARCH + 1];
+    char typo[BENCH_QUERIES][BENCH_SEARCH + 1];
+    struct timespec begin, end;
+    TrigramIndex trigrams;
+
+    srand( BENCH_QUERY_SEED );
+    for ( ii = 0; ii < BENCH_QUERIES; ii++ )
+    {
+        start = 0;
+        length = 0;
+        if ( arraySize > 0 )
+        {
+            id = unsorted[rand( ) % arraySize].title;
+            length = getTitleLength( index->pool, id );
+            if ( length > BENCH_SEARCH )
+            {
+                start = rand( ) % ( length - BENCH_SEARCH + 1 );
+                length = BENCH_SEARCH;
+            }
+            memcpy( text[ii], getTitle( index->pool, id ) + start,
+                        ( size_t )length );
+        }
+        text[ii][length] = '\0';
+
+        strcpy( typo[ii], text[ii] );
+        if ( length > 0 )
+        {
+            typo[ii][rand( ) % length] = 'q';
+        }
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &begin );
+    success = buildTrigramIndex( &trigrams, index );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    result->trigramIndex = elapsedSeconds( &begin, &end );
+
+    success = ( success ) &&
+                ( timeSearches( &trigrams, unsorted, arraySize, text, 0,
+                                &result->search, &result->searchScan,
+                                result ) ) &&
+                ( timeSearches( &trigrams, unsorted, arraySize, typo,
+                                BENCH_EDITS, &result->fuzzy,
+                                &result->fuzzyScan, result ) );
+
+    freeTrigramIndex( &trigrams );
+    return success;
+}
+
+
+
+
+/* NAME: timeSearches
+ * PURPOSE: Time BENCH_QUERIES searches of titles on a trigram index, and
+ *          the first BENCH_SCANS of them as a scan of every entry, checking
+ *          both find the same.
+ * IMPORTS: [ TrigramIndex* ] index: the titles of unsorted, indexed
+ *          [ TVEntry* ] unsorted: the entries, in file order
+ *          [ int ] arraySize: the size of unsorted
+ *          [ char [][] ] text: BENCH_QUERIES texts to search for
+ *          [ int ] edits: the most typos each search allows
+ *          [ double* ] search: where to store the seconds each search took
+ *          on the index on average
+ *          [ double* ] scan: where to store the seconds each scan took
+ *          [ BenchResult* ] result: the file being timed, for errors
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: index was built from the titles of unsorted.
+ *  POST: search and scan hold the timings OR an appropriate error is
+ *        output.
+ * REMARKS: A scan checks each entry with matchTitle(), then sorts what it
+ *          found by name, to give the order searchTitles() does. */
+
+int timeSearches( TrigramIndex *index, TVEntry *unsorted, int arraySize,
+                    char text[][BENCH_SEARCH + 1], int edits, double *search,
+                    double *scan, BenchResult *result )
+{
+    int success, ii, length, column[BENCH_SEARCH + 1];
+    const TitlePool *titles = index->titles->pool;
+    struct timespec start, end;
+    Vector found, scanned;
+    TVEntry *entry;
+
+    initVector( &found, sizeof ( TVEntry ) );
+    initVector( &scanned, sizeof ( TVEntry ) );
+
+    success = TRUE;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( ii = 0; ( ii < BENCH_QUERIES ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        success = searchTitles( index, text[ii], edits, &found );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    *search = elapsedSeconds( &start, &end ) / BENCH_QUERIES;
+
+    *scan = 0.0;
+    for ( ii = 0; ( ii < BENCH_SCANS ) && ( success ); ii++ )
+    {
+        found.length = 0;
+        scanned.length = 0;
+        success = searchTitles( index, text[ii], edits, &found );
+        length = strlen( text[ii] );
+
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        for ( entry = unsorted; ( entry < unsorted + arraySize ) &&
+                ( success ); entry++ )
+        {
+            if ( matchTitle( getTitle( titles, entry->title ),
+                    getTitleLength( titles, entry->title ), text[ii], length,
+                    edits, column ) )
+            {
+                success = pushVector( &scanned, entry );
+            }
+        }
+        success = ( success ) &&
+            ( sortByTime( ( TVEntry* )scanned.data, scanned.length ) ) &&
+            ( sortByRank( ( TVEntry* )scanned.data, scanned.length,
+                            titles->rank, index->titles->count ) );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        *scan += elapsedSeconds( &start, &end ) / BENCH_SCANS;
+
+        if ( ( success ) && ( found.length != scanned.length ) )
+        {
+            fprintf( stderr, "Error: Title search found %d entries, a scan "
+                "found %d in %s\n", found.length, scanned.length,
+                result->filename );
+            success = FALSE;
+        }
+        success = ( success ) && ( sameOrder( ( TVEntry* )scanned.data,
+                        ( TVEntry* )found.data, found.length, "Title search",
+                        result ) );
+    }
+
+    freeVector( &found );
+    freeVector( &scanned );
+    return success;
+}
+
+
+
+
+/* NAME: scanRange
+ * PURPOSE: Find every entry airing from one minute of the week up to
+ *          another, by checking each entry in turn.
+ * IMPORTS: [ const TVEntry* ] array: the entries, in time order
+ *          [ int ] arraySize: the size of the array passed
+ *          [ unsigned int ] from: the minute of the week the span starts
+ *          [ unsigned int ] to: the minute of the week the span ends
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: from and to are below MINUTES_PER_WEEK.
+ *  POST: results holds the same entries queryRange() would find, in the
+ *        same order, OR an error is output.
+ * REMARKS: What a query costs without an index, O(n) every time. A span
+ *          running on into monday is scanned twice, so the entries come
+ *          out in the same order as from queryRange(). */
+
+int scanRange( const TVEntry *array, int arraySize, unsigned int from,
+                unsigned int to, Vector *results )
+{
+    int success = TRUE, ii;
+
+    for ( ii = 0; ( ii < arraySize ) && ( success ); ii++ )
+    {
+        if ( ( array[ii].key >= from ) &&
+                ( ( from >= to ) || ( array[ii].key < to ) ) )
+        {
+            success = pushVector( results, &array[ii] );
+        }
+    }
+
+    for ( ii = 0; ( ii < arraySize ) && ( success ) && ( from >= to );
+            ii++ )
+    {
+        if ( array[ii].key < to )
+        {
+            success = pushVector( results, &array[ii] );
+        }
+    }
+
+    if ( !success )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: copyEntries
+ * PURPOSE: Copy an array of entries over another.
+ * IMPORTS: [ TVEntry* ] to: the array to copy over
+ *          [ TVEntry* ] from: the array to copy
+ *          [ int ] arraySize: the size of the arrays passed
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: Both arrays hold at least arraySize entries.
+ *  POST: to holds the same entries as from.
+ * REMARKS: None */
+
+void copyEntries( TVEntry *to, TVEntry *from, int arraySize )
+{
+    if ( arraySize > 0 )
+    {
+        memcpy( to, from, ( size_t )arraySize * sizeof ( TVEntry ) );
+    }
+}
+
+
+
+
+/* NAME: sameOrder
+ * PURPOSE: Check a sort engine gave exactly the order expected.
+ * IMPORTS: [ TVEntry* ] expected: the entries in the expected order
+ *          [ TVEntry* ] sorted: the entries as the engine sorted them
+ *          [ int ] arraySize: the size of the arrays passed
+ *          [ const char* ] engine: the engine's name, for the error
+ *          [ BenchResult* ] result: the file being timed, for the error
+ * EXPORTS: [ int ] same: TRUE if every entry is in the same place
+ * ASSERTIONS
+ *  PRE: Both arrays hold at least arraySize entries.
+ *  POST: same is TRUE OR an error is output.
+ * REMARKS: None */
+
+int sameOrder( TVEntry *expected, TVEntry *sorted, int arraySize,
+                const char *engine, BenchResult *result )
+{
+    int same = ( arraySize == 0 ) || ( memcmp( expected, sorted,
+                        ( size_t )arraySize * sizeof ( TVEntry ) ) == 0 );
+
+    if ( !same )
+    {
+        fprintf( stderr, "Error: %s order differs from qsort() in %s\n",
+                    engine, result->filename );
+    }
+    return same;
+}
+
+
+
+
+/* NAME: benchFormats
+ * PURPOSE: Time formatting the guide with each engine, and check they give
+ *          the same chars.
+ * IMPORTS: [ TVEntry* ] array: the entries to format
+ *          [ int ] arraySize: the size of array
+ *          [ TitlePool* ] titles: the pool the titles of array are in
+ *          [ BenchResult* ] result: where to store the timings
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: result holds the timings OR an appropriate error is output.
+ * REMARKS: Formatting takes a fraction of writing, so each engine formats
+ *          the guide BENCH_FORMATS times, and only the formatting is timed.
+ *          The block of the last time is kept to check. */
+
+int benchFormats( TVEntry *array, int arraySize, TitlePool *titles,
+                    BenchResult *result )
+{
+    int success = TRUE, engine, ii;
+    char *text[PREFIX_TABLE + 1] = { NULL, NULL };
+    long size[PREFIX_TABLE + 1];
+    struct timespec start, end;
+
+    for ( engine = PREFIX_SPRINTF; ( engine <= PREFIX_TABLE ) &&
+            ( success ); engine++ )
+    {
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        for ( ii = 0; ( ii < BENCH_FORMATS ) && ( success ); ii++ )
+        {
+            free( text[engine] );
+            success = formatGuideWith( array, arraySize, titles,
+                                        &text[engine], &size[engine],
+                                        engine );
+        }
+        clock_gettime( CLOCK_MONOTONIC, &end );
+        result->formats[engine] = elapsedSeconds( &start, &end ) /
+                                    BENCH_FORMATS;
+    }
+
+    if ( ( success ) && ( ( size[PREFIX_SPRINTF] != size[PREFIX_TABLE] ) ||
+            ( memcmp( text[PREFIX_SPRINTF], text[PREFIX_TABLE],
+                        ( size_t )size[PREFIX_TABLE] ) != 0 ) ) )
+    {
+        fprintf( stderr, "Error: Prefix table formats differently from "
+                    "sprintf() in %s\n", result->filename );
+        success = FALSE;
+    }
+
+    free( text[PREFIX_SPRINTF] );
+    free( text[PREFIX_TABLE] );
+    return success;
+}
+
+
+
+/* NAME: sameFiles
+ * PURPOSE: Check two files hold exactly the same chars.
+ * IMPORTS: [ const char* ] expected: the file with the chars expected
+ *          [ const char* ] written: the file to check
+ *          [ BenchResult* ] result: the file being timed, for the error
+ * EXPORTS: [ int ] same: TRUE if every char is the same
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: same is TRUE OR an error is output.
+ * REMARKS: Used to check writeGuide() and writeGuideAsync() write what
+ *          writeFile() does. */
+
+int sameFiles( const char *expected, const char *written,
+                BenchResult *result )
+{
+    int same, ch;
+    FILE *f1 = fopen( expected, "r" );
+    FILE *f2 = fopen( written, "r" );
+
+    same = ( f1 != NULL ) && ( f2 != NULL );
+    while ( ( same ) && ( ( ch = fgetc( f1 ) ) != EOF ) )
+    {
+        same = ( fgetc( f2 ) == ch );
+    }
+    same = ( same ) && ( fgetc( f2 ) == EOF );
+
+    if ( !same )
+    {
+        fprintf( stderr, "Error: %s differs from %s for %s\n", written,
+                    expected, result->filename );
+    }
+    if ( f1 != NULL )
+    {
+        fclose( f1 );
+    }
+    if ( f2 != NULL )
+    {
+        fclose( f2 );
+    }
+    return same;
+}
+
+
+
+/* NAME: silenceOutput
+ * PURPOSE: Send everything printed to stdout to /dev/null instead.
+ * IMPORTS: void
+ * EXPORTS: [ int ] saved: a copy of the real stdout, or -1 if stdout could
+ *          not be silenced
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: stdout goes to /dev/null, until restoreOutput() is given saved.
+ * REMARKS: The results also go to stdout, so the outputArray() phase can
+ *          not simply be redirected by the shell. */
+
+int silenceOutput( void )
+{
+    int saved, null;
+
+    fflush( stdout );
+    saved = dup( STDOUT_FILENO );
+    null = open( "/dev/null", O_WRONLY );
+
+    if ( ( saved != -1 ) && ( null != -1 ) )
+    {
+        dup2( null, STDOUT_FILENO );
+    }
+    else if ( saved != -1 )
+    {
+        close( saved );
+        saved = -1;
+    }
+
+    if ( null != -1 )
+    {
+        close( null );
+    }
+    return saved;
+}
+
+
+
+
+/* NAME: restoreOutput
+ * PURPOSE: Undo silenceOutput(), so stdout goes where it did before.
+ * IMPORTS: [ int ] saved: the copy of stdout given by silenceOutput()
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: saved was given by silenceOutput().
+ *  POST: stdout goes where it did before silenceOutput().
+ * REMARKS: None */
+
+void restoreOutput( int saved )
+{
+    fflush( stdout );
+    if ( saved != -1 )
+    {
+        dup2( saved, STDOUT_FILENO );
+        close( saved );
+    }
+}
+
+
+
+
+/* NAME: rate
+ * PURPOSE: Work out an amount per second, without dividing by 0.
+ * IMPORTS: [ double ] amount: the amount processed
+ *          [ double ] seconds: the time it took
+ * EXPORTS: [ double ] perSecond: amount per second, or 0 if no time passed
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: N/A
+ * REMARKS: None */
+
+double rate( double amount, double seconds )
+{
+    return ( seconds > 0 ) ? amount / seconds : 0.0;
+}
+
+
+
+
+/* NAME: printHeader
+ * PURPOSE: Output what comes before the first row of results.
+ * IMPORTS: [ int ] format: FORMAT_TABLE, FORMAT_CSV or FORMAT_JSON
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: The column names, or the start of the JSON array, are output.
+ * REMARKS: The csv column names come from resultFields(), so they can not
+ *          get out of step with the values. */
+
+void printHeader( int format )
+{
+    int count, ii;
+    BenchField fields[MAX_FIELDS];
+    BenchResult empty;
+
+    if ( format == FORMAT_CSV )
+    {
+        memset( &empty, 0, sizeof ( empty ) );
+        count = resultFields( &empty, fields );
+        printf( "file" );
+        for ( ii = 0; ii < count; ii++ )
+        {
+            printf( ",%s", fields[ii].name );
+        }
+        printf( "\n" );
+    }
+    else if ( format == FORMAT_JSON )
+    {
+        printf( "[\n" );
+    }
+    else
+    {
+        printf( "%-20s %9s %8s %8s %8s %8s %8s %8s %8s %8s %8s %8s %9s\n",
+            "file", "entries", "read", "handoff", "sort tm", "sort nm",
+            "sort rx", "par nm", "filter", "output", "write", "mapped",
+            "read MB/s" );
+    }
+}
+
+
+
+
+/* NAME: printResult
+ * PURPOSE: Output the timings of one file as a row of results.
+ * IMPORTS: [ BenchResult* ] result: the timings to output
+ *          [ int ] format: FORMAT_TABLE, FORMAT_CSV or FORMAT_JSON
+ *          [ int ] first: TRUE if this is the first row output
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: printHeader() has been called.
+ *  POST: One row of results is output.
+ * REMARKS: The table only has room for the main timings, csv and json have
+ *          every field. */
+
+void printResult( BenchResult *result, int format, int first )
+{
+    int count, ii;
+    BenchField fields[MAX_FIELDS];
+
+    count = resultFields( result, fields );
+
+    if ( format == FORMAT_CSV )
+    {
+        printf( "%s", result->filename );
+        for ( ii = 0; ii < count; ii++ )
+        {
+            printf( ",%.*f", fields[ii].decimals, fields[ii].value );
+        }
+        printf( "\n" );
+    }
+    else if ( format == FORMAT_JSON )
+    {
+        printf( "%s  {\"file\": \"%s\"", first ? "" : ",\n",
+                    result->filename );
+        for ( ii = 0; ii < count; ii++ )
+        {
+            printf( ", \"%s\": %.*f", fields[ii].name, fields[ii].decimals,
+                        fields[ii].value );
+        }
+        printf( "}" );
+    }
+    else
+    {
+        printf( "%-20s %9d %8.4f %8.4f %8.4f %8.4f %8.4f %8.4f %8.4f %8.4f "
+            "%8.4f %8.4f %9.1f\n", result->filename, result->entries,
+            result->read, result->handoff, result->sortTime,
+            result->sortName, result->sortRadix, result->parallelName,
+            result->filter, result->output, result->write, result->mapped,
+            rate( ( double )result->bytes / 1e6, result->read ) );
+    }
+}
+
+
+
+
+/* NAME: resultFields
+ * PURPOSE: List every field of a row of results, in column order.
+ * IMPORTS: [ BenchResult* ] result: the timings to list
+ *          [ BenchField [] ] fields: room for MAX_FIELDS fields
+ * EXPORTS: [ int ] count: the amount of fields listed
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: fields holds each field's name, value and decimal places.
+ * REMARKS: Times are in seconds, except for a single query, which is in
+ *          microseconds. Throughput is in MB/s for reading, and
+ *          millions of entries per second (_me_s) for sorting and
+ *          writing. */
+
+int resultFields( BenchResult *result, BenchField fields[] )
+{
+    int count = 0;
+    double megabytes = ( double )result->bytes / 1e6;
+    double millions = ( double )result->entries / 1e6;
+
+    setField( &fields[count++], "entries", result->entries, 0 );
+    setField( &fields[count++], "bytes", result->bytes, 0 );
+    setField( &fields[count++], "read_s", result->read, 6 );
+    setField( &fields[count++], "mapped_s", result->mapped, 6 );
+    setField( &fields[count++], "handoff_s", result->handoff, 6 );
+    setField( &fields[count++], "sort_time_s", result->sortTime, 6 );
+    setField( &fields[count++], "sort_name_s", result->sortName, 6 );
+    setField( &fields[count++], "sort_radix_s", result->sortRadix, 6 );
+    setField( &fields[count++], "par_time_s", result->parallelTime, 6 );
+    setField( &fields[count++], "par_name_s", result->parallelName, 6 );
+    setField( &fields[count++], "filter_s", result->filter, 6 );
+    setField( &fields[count++], "filter_scalar_s",
+                result->kernels[FILTER_SCALAR], 6 );
+    setField( &fields[count++], "filter_sse2_s",
+                result->kernels[FILTER_SSE2], 6 );
+    setField( &fields[count++], "filter_avx2_s",
+                result->kernels[FILTER_AVX2], 6 );
+    setField( &fields[count++], "index_s", result->index, 6 );
+    setField( &fields[count++], "sort_day_s", result->sortDay, 6 );
+    setField( &fields[count++], "time_index_s", result->timeIndex, 6 );
+    setField( &fields[count++], "query_range_us", result->query * 1e6, 3 );
+    setField( &fields[count++], "query_scan_us", result->scan * 1e6, 3 );
+    setField( &fields[count++], "next_index_us", result->next * 1e6, 3 );
+    setField( &fields[count++], "next_select_us", result->select * 1e6, 3 );
+    setField( &fields[count++], "title_index_s", result->titleIndex, 6 );
+    setField( &fields[count++], "prefix_us", result->prefix * 1e6, 3 );
+    setField( &fields[count++], "prefix_scan_us",
+                result->prefixScan * 1e6, 3 );
+    setField( &fields[count++], "trigram_index_s", result->trigramIndex, 6 );
+    setField( &fields[count++], "search_us", result->search * 1e6, 3 );
+    setField( &fields[count++], "search_scan_us",
+                result->searchScan * 1e6, 3 );
+    setField( &fields[count++], "fuzzy_us", result->fuzzy * 1e6, 3 );
+    setField( &fields[count++], "fuzzy_scan_us", result->fuzzyScan * 1e6, 3 );
+    setField( &fields[count++], "schedule_index_s", result->scheduleIndex,
+                6 );
+    setField( &fields[count++], "schedule_us", result->schedule * 1e6, 3 );
+    setField( &fields[count++], "schedule_scan_us",
+                result->scheduleScan * 1e6, 3 );
+    setField( &fields[count++], "output_s", result->output, 6 );
+    setField( &fields[count++], "write_s", result->write, 6 );
+    setField( &fields[count++], "guide_s", result->guide, 6 );
+    setField( &fields[count++], "async_s", result->async, 6 );
+    setField( &fields[count++], "format_sprintf_s",
+                result->formats[PREFIX_SPRINTF], 6 );
+    setField( &fields[count++], "format_table_s",
+                result->formats[PREFIX_TABLE], 6 );
+    setField( &fields[count++], "read_mb_s",
+                rate( megabytes, result->read ), 2 );
+    setField( &fields[count++], "mapped_mb_s",
+                rate( megabytes, result->mapped ), 2 );
+    setField( &fields[count++], "sort_time_me_s",
+                rate( millions, result->sortTime ), 2 );
+    setField( &fields[count++], "sort_name_me_s",
+                rate( millions, result->sortName ), 2 );
+    setField( &fields[count++], "sort_radix_me_s",
+                rate( millions, result->sortRadix ), 2 );
+    setField( &fields[count++], "par_time_me_s",
+                rate( millions, result->parallelTime ), 2 );
+    setField( &fields[count++], "par_name_me_s",
+                rate( millions, result->parallelName ), 2 );
+    setField( &fields[count++], "filter_mb_s", rate( ( double )result->entries
+                * sizeof ( TVEntry ) / 1e6, result->filter ), 2 );
+    setField( &fields[count++], "write_me_s",
+                rate( ( double )result->kept / 1e6, result->write ), 2 );
+    setField( &fields[count++], "guide_me_s",
+                rate( ( double )result->kept / 1e6, result->guide ), 2 );
+    setField( &fields[count++], "async_me_s",
+                rate( ( double )result->kept / 1e6, result->async ), 2 );
+    setField( &fields[count++], "format_sprintf_ml_s",
+                rate( ( double )result->kept / 1e6,
+                        result->formats[PREFIX_SPRINTF] ), 2 );
+    setField( &fields[count++], "format_table_ml_s",
+                rate( ( double )result->kept / 1e6,
+                        result->formats[PREFIX_TABLE] ), 2 );
+    setField( &fields[count++], "vector_grows", result->grows, 0 );
+    setField( &fields[count++], "pool_grows", result->poolGrows, 0 );
+
+    return count;
+}
+
+
+
+
+/* NAME: setField
+ * PURPOSE: Fill in one field of a row of results.
+ * IMPORTS: [ BenchField* ] field: the field to fill in
+ *          [ const char* ] name: the field's column name
+ *          [ double ] value: the field's value
+ *          [ int ] decimals: the decimal places to output the value with
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: field holds name, value and decimals.
+ * REMARKS: C89 only allows constants in the initialiser of an array, so
+ *          the fields are filled in one at a time instead. */
+
+void setField( BenchField *field, const char *name, double value,
+                int decimals )
+{
+    field->name = name;
+    field->value = value;
+    field->decimals = decimals;
+}
+
+
+
+
+/* NAME: printFooter
+ * PURPOSE: Output what comes after the last row of results.
+ * IMPORTS: [ int ] format: FORMAT_TABLE, FORMAT_CSV or FORMAT_JSON
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: The end of the JSON array is output, if needed.
+ * REMARKS: None */
+
+void printFooter( int format )
+{
+    if ( format == FORMAT_JSON )
+    {
+        printf( "\n]\n" );
+    }
+}
@@ -4,7 +4,7 @@
  * PURPOSE: Provide qsort() methods for comparing by time or by name.
             Acts as the logic that decides what is bigger/smaller.
  * REFERENCE: N/A
- * LAST MOD: 24/05/2018
+ * LAST MOD: 17/10/2026
  * COMMENTS: None
  */
 
@@ -12,6 +12,16 @@
 #include "comparison.h"
 
 
+/* name order rank of each title ID of TVEntry structures. qsort() gives no
+ * way to pass extra data to a comparison function, so it is set beforehand
+ * with setTitleRank() */
+static const unsigned int *titleRank = NULL;
+
+/* indexed by dayCode - 1, same order as getDay() */
+static const char *dayNames[DAYS_PER_WEEK] = { "monday", "tuesday",
+            "wednesday", "thursday", "friday", "saturday", "sunday" };
+
+
 
 
 /* NAME: compareByTime
@@ -23,52 +33,28 @@
  * ASSERTIONS
  *  PRE: obj1 and obj2 contain pointers to valid TVEntry structures.
  *  POST: sortVal will give the correct comparison value to qsort().
- * REMARKS: None */
+ * REMARKS: The key is the minute of the week, worked out once when the entry
+ *          was parsed, so comparing keys compares by day, then hour, then
+ *          minute without decoding any day strings. */
 
 int compareByTime( const void *obj1, const void *obj2 )
 {
     int sortVal;
     /* typecast objects to TVEntry pointers */
-    TVEntry *item1 = ( TVEntry* )obj1;
-    TVEntry *item2 = ( TVEntry* )obj2;
-
-    /* compare by day code by using getDay() on TVEntry's day field */
-    int day1 = getDay( item1->day );
-    int day2 = getDay( item2->day );
+    const TVEntry *item1 = ( const TVEntry* )obj1;
+    const TVEntry *item2 = ( const TVEntry* )obj2;
 
-    if ( day1 < day2 ) /* e.g. day1 = Monday, day2 = Friday */
+    if ( item1->key < item2->key ) /* e.g. item1 on Monday, item2 Friday */
     {
         sortVal = -1;
     }
-    else if ( day1 > day2 ) /* e.g. day1 = Tuesday, day2 = Monday */
+    else if ( item1->key > item2->key )
     {
         sortVal = 1;
     }
-    else if ( day1 == day2 ) /* compare by hour next */
+    else /* and if everything is equal, sortVal = 0 */
     {
-        if ( item1->time.hour < item2->time.hour )
-        {
-            sortVal = -1;
-        }
-        else if ( item1->time.hour > item2->time.hour )
-        {
-            sortVal = 1;
-        }
-        else /* finally compare by minute */
-        {
-            if ( item1->time.minute < item2->time.minute )
-            {
-                sortVal = -1;
-            }
-            else if ( item1->time.minute > item2->time.minute )
-            {
-                sortVal = 1;
-            }
-            else /* and if everything is equal, sortVal = 0 */
-            {
-                sortVal = 0;
-            }
-        }
+        sortVal = 0;
     }
 
     return sortVal;
@@ -128,6 +114,79 @@ int getDay( char *day )
 
 
 
+/* NAME: getDayToken
+ * PURPOSE: Gives the day code of a day that is not null-terminated, such as
+ *          a word inside a memory mapped file.
+ * IMPORTS: [ const char* ] token: the first char of the day, in any case
+ *          [ int ] length: the amount of chars in the day
+ * EXPORTS: [ int ] dayCode: the ID for each day
+ * ASSERTIONS
+ *  PRE: token points to at least length chars.
+ *  POST: dayCode will be between 1-7 inclusive, the same as getDay() would
+ *        give for the lowercase copy of token, or 0 if the day is invalid.
+ * REMARKS: Comparison ignores case so that the token does not need to be
+ *          copied out and made lowercase first. */
+
+int getDayToken( const char *token, int length )
+{
+    int dayCode = 0, ii, jj;
+
+    /* stop at the first day that matches every char and the length */
+    for ( ii = 0; ( ii < DAYS_PER_WEEK ) && ( dayCode == 0 ); ii++ )
+    {
+        jj = 0;
+        while ( ( jj < length ) && ( dayNames[ii][jj] != '\0' ) &&
+                    ( tolower( token[jj] ) == dayNames[ii][jj] ) )
+        {
+            jj++;
+        }
+
+        if ( ( jj == length ) && ( dayNames[ii][jj] == '\0' ) )
+        {
+            dayCode = ii + 1;
+        }
+    }
+    return dayCode;
+}
+
+
+
+
+/* NAME: getDayName
+ * PURPOSE: Gives the name of a day from its "ID", the reverse of getDay().
+ * IMPORTS: [ int ] dayCode: the ID of the day
+ * EXPORTS: [ const char* ] day: lowercase name of the day
+ * ASSERTIONS
+ *  PRE: dayCode is between 1-7 inclusive.
+ *  POST: getDay() gives dayCode back for day.
+ * REMARKS: The name is not copied, so it must not be changed. */
+
+const char* getDayName( int dayCode )
+{
+    return dayNames[dayCode - 1];
+}
+
+
+
+
+/* NAME: setTitleRank
+ * PURPOSE: Set the ranks that compareByName() orders title IDs by.
+ * IMPORTS: [ const unsigned int* ] rank: array indexed by title ID of the
+ *          title's place in name order, as given by rankTitles()
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: rank holds every title ID of the TVEntry structures to be sorted.
+ *  POST: compareByName() will compare the ranks of titles.
+ * REMARKS: Must be called before passing compareByName() to qsort(). */
+
+void setTitleRank( const unsigned int *rank )
+{
+    titleRank = rank;
+}
+
+
+
+
 /* NAME: compareByName
  * PURPOSE: Provide comparison by title of TVEntry structure.
  * IMPORTS: [ const void* ] obj1: item1 to compare
@@ -136,35 +195,64 @@ int getDay( char *day )
  *          -1 for i1 < i2, 1 for i1 > i2, and 0 for i1 == i2
  * ASSERTIONS
  *  PRE: obj1 and obj2 contain pointers to valid TVEntry structures.
+ *       setTitleRank() has been given the ranks of the titles.
  *  POST: sortVal will give the correct comparison value to qsort().
- * REMARKS: If <strings.h> library is allowed to be used, this function can be
- *          reduced to dereferencing to str1 and str2, and then passing both 
- *          to strcasecmp( str1, str2 ), which will compare both strings,
- *          converting uppercase to lowercase for easy comparison. */
+ * REMARKS: The titles were already put in order by compareTitles() when
+ *          they were ranked, so only their ranks need comparing here. */
 
 int compareByName( const void *obj1, const void *obj2 )
 {
     int sortVal;
     /* typecast objects to TVEntry pointers */
-    TVEntry *item1 = ( TVEntry* )obj1;
-    TVEntry *item2 = ( TVEntry* )obj2;
+    const TVEntry *item1 = ( const TVEntry* )obj1;
+    const TVEntry *item2 = ( const TVEntry* )obj2;
+
+    unsigned int rank1 = titleRank[item1->title];
+    unsigned int rank2 = titleRank[item2->title];
+
+    if ( rank1 < rank2 )
+    {
+        sortVal = -1;
+    }
+    else if ( rank1 > rank2 )
+    {
+        sortVal = 1;
+    }
+    else
+    {
+        sortVal = 0;
+    }
+
+    return sortVal;
+}
+
 
-    /* strings are found in the structure's title field */
-    char *str1 = ( char* )( item1->title );
-    char *str2 = ( char* )( item2->title );
 
-    /* below function is the alternative way of comparing strings
-     * irrespective of case. Uses non-standard <strings.h> library
-     * so not included just in case its not allowed */
-    /*  sortVal = strcasecmp( str1, str2 ); */
 
+/* NAME: compareTitles
+ * PURPOSE: Compare two titles, ignoring case.
+ * IMPORTS: [ const char* ] str1: title1 to compare
+ *          [ const char* ] str2: title2 to compare
+ * EXPORTS: [ int ] sortVal: The value of the comparison;
+ *          -1 for t1 < t2, 1 for t1 > t2, and 0 for t1 == t2
+ * ASSERTIONS
+ *  PRE: str1 and str2 are both ended by a newline.
+ *  POST: sortVal gives the order of the titles.
+ * REMARKS: If <strings.h> library is allowed to be used, this function could
+ *          use strncasecmp(), if the titles' lengths were worked out first.
+ *          Titles end with a newline rather than a null-terminator, and the
+ *          newline is compared like any other char, as it always has been
+ *          since titles were read in with fgets(). */
 
+int compareTitles( const char *str1, const char *str2 )
+{
+    int sortVal;
     char ch1, ch2;
     /* read each string character by character, and while the characters
-     * are not NULL-terminators, AND the characters are equal,
+     * are not the newlines ending the titles, AND the characters are equal,
      * keep looping through to new characters */
-    while( ( *str1 != '\0' ) && ( *str2 != '\0' ) && 
-         ( tolower( *str1 ) == tolower( *str2 ) ) ) 
+    while( ( *str1 != '\n' ) && ( *str2 != '\n' ) &&
+         ( tolower( *str1 ) == tolower( *str2 ) ) )
     {
         /* increment pointer for both strings, so that it points
          * to the next character in the string */
@@ -192,3 +280,77 @@ int compareByName( const void *obj1, const void *obj2 )
 
     return sortVal;
 }
+
+
+
+
+/* NAME: foldChar
+ * PURPOSE: Give the place of a char in the order compareTitles() uses.
+ * IMPORTS: [ char ] ch: the char to fold
+ * EXPORTS: [ int ] order: from 0 to 255, the same for chars that only
+ *          differ by case
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: For any two chars, comparing their orders gives the same result as
+ *        compareTitles() comparing them.
+ * REMARKS: compareTitles() compares lowercase chars as plain char, which is
+ *          signed on some platforms, so the top bit is flipped there to keep
+ *          negative chars first when the order is compared unsigned. */
+
+int foldChar( char ch )
+{
+    char folded = tolower( ch );
+    int order = ( unsigned char )folded;
+
+#if CHAR_MIN < 0
+    order ^= 0x80;
+#endif
+
+    return order;
+}
+
+
+
+
+/* NAME: comparePrefix
+ * PURPOSE: Compare the start of a title with a prefix, ignoring case, in
+ *          the same order compareTitles() gives.
+ * IMPORTS: [ const char* ] title: the title, ended by a newline
+ *          [ const char* ] prefix: the chars the title may start with
+ *          [ int ] length: the amount of chars in prefix
+ * EXPORTS: [ int ] sortVal: below 0 if the title comes before every title
+ *          starting with prefix, 0 if it starts with prefix, or above 0 if
+ *          it comes after them all
+ * ASSERTIONS
+ *  PRE: prefix points to at least length chars.
+ *  POST: Titles starting with prefix are next to each other in name order,
+ *        between the ones giving below 0 and above 0.
+ * REMARKS: A title ending before the prefix does is compared by its
+ *          newline, the same as compareTitles() would compare it to a
+ *          longer title, so "Star" comes before the prefix "Star W". */
+
+int comparePrefix( const char *title, const char *prefix, int length )
+{
+    int sortVal, ii = 0;
+
+    while ( ( ii < length ) && ( title[ii] != '\n' ) &&
+            ( foldChar( title[ii] ) == foldChar( prefix[ii] ) ) )
+    {
+        ii++;
+    }
+
+    if ( ii == length )
+    {
+        sortVal = 0;
+    }
+    /* the title is shorter, unless the prefix has a char before newline */
+    else if ( title[ii] == '\n' )
+    {
+        sortVal = ( foldChar( '\n' ) <= foldChar( prefix[ii] ) ) ? -1 : 1;
+    }
+    else
+    {
+        sortVal = foldChar( title[ii] ) - foldChar( prefix[ii] );
+    }
+    return sortVal;
+}
@@ -3,7 +3,7 @@
  * UNIT: Unix and C Programming
  * PURPOSE: General header includes and forward-declarations.
  * REFERENCE: N/A
- * LAST MOD: 24/05/2018
+ * LAST MOD: 17/10/2026
  * COMMENTS: <strings.h> commented out, but could be uncommented if allowed
  *           to use that library for its strcasecmp() function.
  */
@@ -17,6 +17,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <limits.h>
 /*#include <strings.h>*/
 
 #include "data.h"
@@ -24,7 +25,13 @@
 
 int compareByTime( const void *obj1, const void *obj2 );
 int getDay( char *day );
+int getDayToken( const char *token, int length );
+const char* getDayName( int dayCode );
+void setTitleRank( const unsigned int *rank );
 int compareByName( const void *obj1, const void *obj2 );
+int compareTitles( const char *str1, const char *str2 );
+int foldChar( char ch );
+int comparePrefix( const char *title, const char *prefix, int length );
 
 
 
@@ -3,7 +3,7 @@
  * UNIT: Unix and C Programming
  * PURPOSE: Define a structure appropriate for storing TV guide entries.
  * REFERENCE: N/A
- * LAST MOD: 24/05/2018
+ * LAST MOD: 16/10/2026
  * COMMENTS: None
  */
 
@@ -14,29 +14,36 @@
 
 
 #define NAME_SIZE 100
-#define DAY_SIZE 11 
+#define DAY_SIZE 11
+
+#define DAYS_PER_WEEK 7
+#define MINUTES_PER_DAY 1440
+
+/* hour and minute of a TVEntry, worked out from its minute-of-week key */
+#define ENTRY_HOUR( entry ) ( ( ( entry ).key % MINUTES_PER_DAY ) / 60 )
+#define ENTRY_MINUTE( entry ) ( ( entry ).key % 60 )
 
 
 /* NAME: TVEntry
  * PURPOSE: Allow a TV guide entry of a certain format to be parsed from a
- *          file into a suitable structure.
- * FIELDS:  [ char [] ] title: represents the name of the TV show
- *          [ char [] ] day: represents the day of the TV show
- *          [ time ] : a structure in itself containing hour and minute
- *          [ int ] hour : represents the hour of the TV show
- *          [ int ] minute : represents the minute of the TV show
+ *          file into a compact structure that is quick to sort and filter.
+ * FIELDS:  [ unsigned int ] title: ID of the name of the TV show, within
+ *          the TitlePool the entry's titles are interned in
+ *          [ unsigned short ] key: minute of the week of the TV show,
+ *          ( day - 1 ) * MINUTES_PER_DAY + hour * 60 + minute, so ordering
+ *          by key is ordering by day, then hour, then minute
+ *          [ unsigned char ] day: the day code of the TV show, as given by
+ *          getDay(), from 1 for monday to 7 for sunday
  * REMARKS: Validation should occur external to the structure. It is the
  *          responsibility of the implementer to handle validity.
- *          The only validation the structure has is that title and day
- *          should be of max size, seen defined above. */
+ *          Titles are not stored in the structure, entries with the same
+ *          title share its ID, so titles are equal exactly when IDs are. The
+ *          pool must outlive any entry referring to it. */
 
 typedef struct {
-    char title[NAME_SIZE];
-    char day[DAY_SIZE];
-    struct {
-        int hour;
-        int minute;
-    } time;    
+    unsigned int title;
+    unsigned short key;
+    unsigned char day;
 } TVEntry;
 
 
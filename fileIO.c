@@ -3,16 +3,96 @@
  * UNIT: Unix and C Programming
  * PURPOSE: Handle any reading or writing of files.
  * REFERENCE: N/A
- * LAST MOD: 24/05/2018
- * COMMENTS: None
+ * LAST MOD: 17/10/2026
+ * COMMENTS: readMappedFile() uses the POSIX mmap() and pthreads rather than
+ *           C89 functions, and writeGuide() the POSIX open() and write(), so
+ *           _POSIX_C_SOURCE is defined before any includes.
  */
 
 
+#define _POSIX_C_SOURCE 200112L
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
+
 #include "io.h"
 
 
+/* results of parsing one record of a mapped file, every result other than
+ * PARSE_OK has an error message output by reportParseError() */
+#define PARSE_OK 0
+#define PARSE_EMPTY_TITLE 1
+#define PARSE_NO_TIME_LINE 2
+#define PARSE_BAD_SCAN 3
+#define PARSE_BAD_DAY 4
+#define PARSE_BAD_TIME 5
+#define PARSE_NO_MEMORY 6
+
+/* most threads a mapped file is parsed with, and the least amount of bytes
+ * worth giving a thread of its own */
+#define MAX_THREADS 64
+#define MIN_CHUNK_SIZE 65536
+
+
+/* the "HH:MM - " of every minute of the day, built the first time the
+ * guide is formatted, as there are only MINUTES_PER_DAY of them */
+static char prefixTable[MINUTES_PER_DAY][PREFIX_SIZE];
+static int prefixTableBuilt = FALSE;
+
+
+/* NAME: ParseChunk
+ * PURPOSE: Hold one thread's share of parsing a mapped file.
+ * FIELDS:  [ const char* ] text: the whole text being parsed
+ *          [ long ] textSize: the amount of chars in text
+ *          [ long ] start: index of the first record of the chunk
+ *          [ long ] end: records starting at or after this index belong to
+ *          the next chunk
+ *          [ long ] stop: index parsing stopped at, which is end unless a
+ *          record failed or the last record ran past end
+ *          [ int ] dayCode: getDay() code of the only day to store, or 0
+ *          to store every day
+ *          [ Vector ] entries: vector of the TVEntry structures parsed
+ *          [ TitlePool ] titles: the chunk's own pool of the titles of its
+ *          entries, so threads do not share a pool
+ *          [ int ] status: PARSE_OK, or the error of the record that failed
+ *          [ int ] threaded: TRUE if the chunk was given its own thread
+ * REMARKS: Private to this file, used by processMapped(). */
+
+typedef struct {
+    const char *text;
+    long textSize;
+    long start;
+    long end;
+    long stop;
+    int dayCode;
+    Vector entries;
+    TitlePool titles;
+    int status;
+    int threaded;
+} ParseChunk;
+
+
 /* private to other files as its specific to this file's methods */
-static int processFile( FILE *f, LinkedList *list );
+static int processFile( FILE *f, Vector *entries, TitlePool *titles,
+                            int dayCode );
+static int processMapped( MappedGuide *guide, int threads, int dayCode );
+static void* parseChunk( void *arg );
+static long findRecordStart( const char *text, long textSize, long pos );
+static int mergeChunks( MappedGuide *guide, ParseChunk *chunks,
+                            int threads, int total );
+static int parseRecord( const char *text, long textSize, long *pos,
+                            TVEntry *entry, const char **title,
+                            int *length );
+static int scanTimeLine( const char *line, const char *end, int *day,
+                            int *hour, int *minute );
+static int scanNumber( const char **str, const char *end, int *number );
+static void reportParseError( int status );
+static void buildPrefixTable( void );
 
 
 
@@ -21,16 +101,23 @@ static int processFile( FILE *f, LinkedList *list );
  * PURPOSE: Open a file for reading, and call a helper function to parse
  *          the contents into a data structure.
  * IMPORTS: [ char [] ] filename: file to read from
- *          [ LinkedList* ] list: a LL data structure to store into
+ *          [ Vector* ] entries: a vector of TVEntry to store into
+ *          [ TitlePool* ] titles: pool to intern the entries' titles into
+ *          [ int ] dayCode: getDay() code of the only day to store, or 0
+ *          to store every day
  * EXPORTS: [ int ] success: success or failure of the function
  *          FALSE (0) is used for failure, TRUE (!0) is used for success
  * ASSERTIONS
  *  PRE: filename is to be read from, and has appropriate structure.
  *  POST: The file will be read completely OR an appropriate error is output.
  * REMARKS: Function is very specific to this task and is likely unsuitable
- *          for major reuse outside of this program. */
+ *          for major reuse outside of this program. Entries on other days
+ *          are still checked for errors, they are just never stored.
+ *          titles should be given to freeTitlePool() once the entries
+ *          are no longer needed. */
 
-int readFile( char filename[], LinkedList* list )
+int readFile( char filename[], Vector *entries, TitlePool *titles,
+                int dayCode )
 {
     int success = TRUE;
     FILE *f = fopen( filename, "r" );
@@ -42,8 +129,8 @@ int readFile( char filename[], LinkedList* list )
     }
     else
     {
-        /* process the file, passing it the file* and list*/
-        success = processFile( f, list );
+        /* process the file, passing it the file* and vector */
+        success = processFile( f, entries, titles, dayCode );
 
         /* if there is an error, print and flag failure */
         if ( ferror( f ) )
@@ -67,6 +154,8 @@ int readFile( char filename[], LinkedList* list )
  * IMPORTS: [ char [] ] filename: file to read to
  *          [ TVEntry* ] array: array of TVEntry structure to output
  *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
  * EXPORTS: [ int ] success: success or failure of the function
  *          FALSE (0) is used for failure, TRUE (!0) is used for success
  * ASSERTIONS
@@ -76,7 +165,8 @@ int readFile( char filename[], LinkedList* list )
  * REMARKS: Function is very specific to this task and is likely unsuitable
  *          for major reuse outside of this program. */
 
-int writeFile( char filename[], TVEntry *array, int arraySize )
+int writeFile( char filename[], TVEntry *array, int arraySize,
+                    const TitlePool *titles )
 {
     int success = TRUE;
     FILE *f = fopen( filename, "w" );
@@ -94,11 +184,14 @@ int writeFile( char filename[], TVEntry *array, int arraySize )
         fprintf( f, "* %19s                *\n", array->day );
         fprintf( f, "**************************************\n" );*/
 
-        /* print out array in specified format */
+        /* print out array in specified format, the title is printed up
+         * to and including its newline */
         for (ii = 0; ii < arraySize; ii++ )
         {
-            fprintf( f, "%2d:%02d - %s", array[ii].time.hour,
-            array[ii].time.minute, array[ii].title );
+            fprintf( f, "%2d:%02d - %.*s", ENTRY_HOUR( array[ii] ),
+            ENTRY_MINUTE( array[ii] ),
+            getTitleLength( titles, array[ii].title ) + 1,
+            getTitle( titles, array[ii].title ) );
         }
 
         /* if there is an error, print and flag failure */
@@ -116,26 +209,343 @@ int writeFile( char filename[], TVEntry *array, int arraySize )
 
 
 
+/* NAME: writeGuide
+ * PURPOSE: Output an array to screen and write it to a file, formatting
+ *          each entry only once for both.
+ * IMPORTS: [ char [] ] filename: file to write to
+ *          [ TVEntry* ] array: array of TVEntry structure to output
+ *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ const char* ] empty: the message to output when array is
+ *          empty, EMPTY_DAY or EMPTY_QUERY
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: filename is to be written to. arraySize is the size of the array.
+ *  POST: The array is output to screen and written to file, the same as
+ *        outputArray() and writeFile() would, OR an error is output.
+ * REMARKS: The entries are formatted into one block by formatGuide(),
+ *          which is written to the screen and then the file with write(),
+ *          rather than each line being formatted by printf() and again by
+ *          fprintf(). stdout is flushed first, so the prompts before it
+ *          still come first. */
+
+int writeGuide( char filename[], TVEntry *array, int arraySize,
+                    const TitlePool *titles, const char *empty )
+{
+    int success;
+    char *text = NULL;
+    long size;
+
+    success = formatGuide( array, arraySize, titles, &text, &size );
+
+    /* the screen gets the same blank lines and message outputArray() gives,
+     * but a screen that can not be written to is not an error, as before */
+    fflush( stdout );
+    writeAll( STDOUT_FILENO, "\n\n", 2 );
+    if ( arraySize == 0 )
+    {
+        fprintf( stderr, "%s\n", empty );
+    }
+    else if ( success )
+    {
+        writeAll( STDOUT_FILENO, text, size );
+    }
+
+    if ( success )
+    {
+        success = writeText( filename, text, size );
+    }
+
+    free( text );
+    return success;
+}
+
+
+
+
+/* NAME: writeText
+ * PURPOSE: Write a block of formatted text to a file.
+ * IMPORTS: [ char [] ] filename: file to write to
+ *          [ const char* ] text: the chars to write
+ *          [ long ] size: the amount of chars to write
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: filename is to be written to.
+ *  POST: The file holds exactly the chars of text OR an error is output.
+ * REMARKS: Gives the same errors writeFile() does, so a guide formatted by
+ *          formatGuide() can be written in its place. */
+
+int writeText( char filename[], const char *text, long size )
+{
+    int success = TRUE, fd;
+
+    fd = open( filename, O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+    /* fd is -1 when it errors out */
+    if ( fd == -1 )
+    {
+        perror( "Error writing file" );
+        success = FALSE;
+    }
+    else
+    {
+        if ( !writeAll( fd, text, size ) )
+        {
+            perror( "Error while writing from file" );
+            success = FALSE;
+        }
+
+        if ( close( fd ) == -1 )
+        {
+            perror( "Error while writing from file" );
+            success = FALSE;
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: formatGuide
+ * PURPOSE: Format every entry of an array into one block of text, in the
+ *          format the guide is output in.
+ * IMPORTS: [ TVEntry* ] array: array of TVEntry structure to format
+ *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ char** ] text: where to store the block, which is allocated
+ *          [ long* ] size: where to store the amount of chars in the block
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: *text holds a line per entry and should be given to free(), OR an
+ *        error is output and *text is NULL.
+ * REMARKS: Formats with PREFIX_TABLE, the quickest. */
+
+int formatGuide( TVEntry *array, int arraySize, const TitlePool *titles,
+                    char **text, long *size )
+{
+    return formatGuideWith( array, arraySize, titles, text, size,
+                                PREFIX_TABLE );
+}
+
+
+
+
+/* NAME: formatGuideWith
+ * PURPOSE: Same as formatGuide(), with a given way to format the time each
+ *          line starts with.
+ * IMPORTS: [ TVEntry* ] array: array of TVEntry structure to format
+ *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ char** ] text: where to store the block, which is allocated
+ *          [ long* ] size: where to store the amount of chars in the block
+ *          [ int ] engine: PREFIX_SPRINTF to format each time with
+ *          sprintf(), or PREFIX_TABLE to copy it from a table
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: The same as formatGuide().
+ *  POST: The same as formatGuide().
+ * REMARKS: The block is measured first, so it is allocated once. Both
+ *          ways give the same chars, the table just skips parsing a format
+ *          and converting two ints for every line. Given an engine so
+ *          Benchmark can time and check each of them. */
+
+int formatGuideWith( TVEntry *array, int arraySize, const TitlePool *titles,
+                        char **text, long *size, int engine )
+{
+    int success = TRUE;
+
+    *size = measureGuide( array, arraySize, titles );
+    *text = ( char* )malloc( ( size_t )*size + 1 );
+    if ( *text == NULL )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        fillGuide( array, arraySize, titles, *text, engine );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: measureGuide
+ * PURPOSE: Work out how many chars the lines of an array take.
+ * IMPORTS: [ TVEntry* ] array: array of TVEntry structure to measure
+ *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ * EXPORTS: [ long ] size: the amount of chars fillGuide() writes
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: N/A
+ * REMARKS: Every line starts with "HH:MM - ", which is always PREFIX_SIZE
+ *          chars, so the size is known before any line is formatted. */
+
+long measureGuide( TVEntry *array, int arraySize, const TitlePool *titles )
+{
+    int ii;
+    long size = 0;
+
+    for ( ii = 0; ii < arraySize; ii++ )
+    {
+        size += PREFIX_SIZE + getTitleLength( titles, array[ii].title ) + 1;
+    }
+    return size;
+}
+
+
+
+
+/* NAME: fillGuide
+ * PURPOSE: Format every entry of an array into a block of text that has
+ *          already been allocated.
+ * IMPORTS: [ TVEntry* ] array: array of TVEntry structure to format
+ *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ char* ] text: where to write the lines
+ *          [ int ] engine: PREFIX_SPRINTF or PREFIX_TABLE
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: text has room for measureGuide() chars of the same array.
+ *  POST: text holds a line per entry, without a null-terminator.
+ * REMARKS: Only called from the main thread, as the prefix table is built
+ *          the first time it is needed. */
+
+void fillGuide( TVEntry *array, int arraySize, const TitlePool *titles,
+                    char *text, int engine )
+{
+    int ii, length;
+    char prefix[PREFIX_SIZE + 1];
+
+    if ( !prefixTableBuilt )
+    {
+        buildPrefixTable( );
+    }
+
+    /* the title is copied up to and including its newline */
+    for ( ii = 0; ii < arraySize; ii++ )
+    {
+        length = getTitleLength( titles, array[ii].title ) + 1;
+        if ( engine == PREFIX_TABLE )
+        {
+            memcpy( text, prefixTable[array[ii].key % MINUTES_PER_DAY],
+                        PREFIX_SIZE );
+        }
+        else
+        {
+            sprintf( prefix, "%2d:%02d - ", ENTRY_HOUR( array[ii] ),
+                        ENTRY_MINUTE( array[ii] ) );
+            memcpy( text, prefix, PREFIX_SIZE );
+        }
+        memcpy( text + PREFIX_SIZE, getTitle( titles, array[ii].title ),
+                    ( size_t )length );
+        text += PREFIX_SIZE + length;
+    }
+}
+
+
+
+
+/* NAME: writeAll
+ * PURPOSE: Write a block of chars to a file descriptor.
+ * IMPORTS: [ int ] fd: the file descriptor to write to
+ *          [ const char* ] text: the chars to write
+ *          [ long ] size: the amount of chars to write
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: fd is open for writing.
+ *  POST: Every char has been written OR FALSE is returned, with errno set.
+ * REMARKS: write() may write less than it was given, or be interrupted by
+ *          a signal, so it is called until the whole block is written. */
+
+int writeAll( int fd, const char *text, long size )
+{
+    int success = TRUE;
+    long done = 0;
+    ssize_t written;
+
+    while ( ( done < size ) && ( success ) )
+    {
+        written = write( fd, text + done, ( size_t )( size - done ) );
+        if ( written >= 0 )
+        {
+            done += written;
+        }
+        else if ( errno != EINTR )
+        {
+            success = FALSE;
+        }
+    }
+    return success;
+}
+
+
+
+/* NAME: buildPrefixTable
+ * PURPOSE: Fill the table of the "HH:MM - " of every minute of the day.
+ * IMPORTS: void
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: prefixTable holds the prefix of each minute, the same chars
+ *        outputArray() prints before a title.
+ * REMARKS: Private to this file. Only called from the main thread, so the
+ *          table is not built twice at once. */
+
+void buildPrefixTable( void )
+{
+    int minute;
+    char prefix[PREFIX_SIZE + 1];
+
+    for ( minute = 0; minute < MINUTES_PER_DAY; minute++ )
+    {
+        sprintf( prefix, "%2d:%02d - ", minute / 60, minute % 60 );
+        memcpy( prefixTable[minute], prefix, PREFIX_SIZE );
+    }
+    prefixTableBuilt = TRUE;
+}
+
+
+
 /* NAME: processFile
- * PURPOSE: Parse the file's contents into a linked list, ensuring that all
+ * PURPOSE: Parse the file's contents into a vector, ensuring that all
  *          data makes logical sense (such as hour being between 0-23).
  * IMPORTS: [ FILE* ] f: Pointer to FILE from caller function
- *          [ LinkedList* ] list: a LL data structure to store into
+ *          [ Vector* ] entries: a vector of TVEntry to store into
+ *          [ TitlePool* ] titles: pool to intern the entries' titles into
+ *          [ int ] dayCode: getDay() code of the only day to store, or 0
+ *          to store every day
  * EXPORTS: [ int ] success: success or failure of the function
  *          FALSE (0) is used for failure, TRUE (!0) is used for success
  * ASSERTIONS
  *  PRE: N/A
- *  POST: File contents have been parsed into LL or an appropriate error has
- *  been output.
- * REMARKS: Helper function to readFile(). */
+ *  POST: File contents have been parsed into the vector or an appropriate
+ *  error has been output.
+ * REMARKS: Helper function to readFile(). Entries are built on the stack
+ *          and copied into the vector's contiguous storage, so reading n
+ *          entries makes no per entry malloc() calls. */
 
-int processFile( FILE *f, LinkedList *list )
+int processFile( FILE *f, Vector *entries, TitlePool *titles,
+                    int dayCode )
 {
     int success = TRUE;
-    char name[NAME_SIZE];
-    char line[NAME_SIZE];
+    char name[LINE_SIZE];
+    char line[LINE_SIZE];
     char day[DAY_SIZE];
-    int hour, minute;
+    int hour, minute, length;
 
     /* while not EOF (fgets would be NULL on EOF)
      * AND while there is no error ( success == TRUE ) */
@@ -159,63 +569,77 @@ int processFile( FILE *f, LinkedList *list )
             else
             {
                 int scans = 0;
-                /* malloc the data to put in the LL, so it exists outside
-                 * of this method */
-                TVEntry *entry = (TVEntry*) malloc( sizeof ( TVEntry ) );
-                /* if the malloc fails, entry will be NULL */
-                if ( entry == NULL )
+                TVEntry entry;
+
+                /* the newline fgets() kept is not part of the title, as
+                 * the pool ends each title with its own */
+                length = ( int )strlen( name );
+                if ( name[length - 1] == '\n' )
                 {
-                    fprintf( stderr, "Error: Memory not assigned!\n" );
+                    length--;
+                }
+
+                hour = 0;
+                minute = 0;
+                /* process the fgets line for specific format */
+                scans = sscanf( line, "%s %d:%d", day, &hour, &minute );
+                /* convert day to lowercase for later comparison */
+                makeLower( day );
+
+                /* Require scans for day, hour, and minute */
+                if ( scans != 3 )
+                {
+                    fprintf( stderr, "Error: Could not scan in "
+                                 "file parameters!\n" );
                     success = FALSE;
                 }
-                else
+                /* getDay() will get a number representing the day of the
+                 * week, 1-7 or 0 if unsuccessful. Check if unsuccessful*/
+                else if ( getDay( day ) == 0 )
                 {
-                    hour = 0;
-                    minute = 0;
-                    /* process the fgets line for specific format */
-                    scans = sscanf( line, "%s %d:%d", day, &hour, &minute );
-                    /* convert day to lowercase for later comparison */
-                    makeLower( day );
-
-                    /* Require scans for day, hour, and minute */
-                    if ( scans != 3 )
-                    {
-                        fprintf( stderr, "Error: Could not scan in "
-                                     "file parameters!\n" );
-                        free( entry );
-                        success = FALSE;
-                    }
-                    /* getDay() will get a number representing the day of the
-                     * week, 1-7 or 0 if unsuccessful. Check if unsuccessful*/
-                    else if ( getDay( day ) == 0 )
-                    {
-                        fprintf( stderr, "Error: Incorrect day "
+                    fprintf( stderr, "Error: Incorrect day "
+                        "in file!\n" );
+                    success = FALSE;
+                }
+                /* otherwise check hour and minute being correct values */
+                else if ( ( hour < 0 ) || ( hour > 23 ) ||
+                            ( minute < 0 ) || ( minute > 59 ) )
+                {
+                    fprintf( stderr, "Error: Incorrect time "
                             "in file!\n" );
-                        free( entry );
-                        success = FALSE;
-                    }
-                    /* otherwise check hour and minute being correct values */
-                    else if ( ( hour < 0 ) || ( hour > 23 ) ||
-                                ( minute < 0 ) || ( minute > 59 ) )
+                    success = FALSE;
+                }
+                /* a valid entry on a day that was not asked for is skipped
+                 * here, before anything has been allocated for it */
+                else if ( ( dayCode != 0 ) && ( getDay( day ) != dayCode ) )
+                {
+                    /* nothing to store, move on to the next entry */
+                }
+                /* Only now can further processing be done */
+                else
+                {
+                    /* the title is interned in titles, so the entry only
+                     * holds its ID */
+                    if ( !internTitle( titles, name, length, &entry.title ) )
                     {
-                        fprintf( stderr, "Error: Incorrect time "
-                                "in file!\n" );
-                        free( entry );
+                        fprintf( stderr, "Error: Memory not assigned!\n" );
                         success = FALSE;
                     }
-                    /* Only now can further processing be done */
                     else
                     {
-                        /* strncpy as string can't be defined after
-                         * being initialised in main() */ 
-                        strncpy( entry->title, name, NAME_SIZE );
-                        strncpy( entry->day, day, DAY_SIZE );
-                        /* set entry's other structure fields */
-                        entry->time.hour = hour;
-                        entry->time.minute = minute;
-
-                        /* and insert this finished entry at the end of LL */
-                        insertLast( list, entry );
+                        /* set entry's other structure fields, the key is
+                         * worked out once here rather than every sort */
+                        entry.day = ( unsigned char )getDay( day );
+                        entry.key = ( unsigned short )( ( entry.day - 1 ) *
+                                MINUTES_PER_DAY + hour * 60 + minute );
+
+                        /* and copy this finished entry onto the end of the
+                         * vector, where it stays until it is output */
+                        if ( !pushVector( entries, &entry ) )
+                        {
+                            fprintf( stderr, "Error: Memory not assigned!\n" );
+                            success = FALSE;
+                        }
                     }
                 }
             }
@@ -223,3 +647,723 @@ int processFile( FILE *f, LinkedList *list )
     }
     return success;
 }
+
+
+
+
+/* NAME: readMappedFile
+ * PURPOSE: Memory map a file, and call a helper function to parse the
+ *          contents in place, only copying each distinct title out once.
+ * IMPORTS: [ char [] ] filename: file to read from
+ *          [ MappedGuide* ] guide: structure to store the mapping and
+ *          the entries parsed from it into
+ *          [ int ] threads: the amount of threads to parse with, 1 to
+ *          parse without starting any threads
+ *          [ int ] dayCode: getDay() code of the only day to store, or 0
+ *          to store every day
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: filename is to be read from, and has appropriate structure.
+ *  POST: The file will be mapped and parsed completely OR an appropriate
+ *        error is output and guide holds nothing that needs freeing.
+ * REMARKS: Alternative to readFile(), which reads with fgets() and copies
+ *          every entry into a vector. Once parsed, nothing refers into the
+ *          mapping, so it is released straight away. The guide must be given
+ *          to freeMappedGuide() once its entries are no longer needed. */
+
+int readMappedFile( char filename[], MappedGuide *guide, int threads,
+                        int dayCode )
+{
+    int success = TRUE;
+    struct stat info;
+    int fd = open( filename, O_RDONLY );
+
+    guide->text = NULL;
+    guide->textSize = 0;
+    guide->entries = NULL;
+    guide->length = 0;
+    initTitlePool( &guide->titles );
+
+    /* fd is -1 when it errors out */
+    if ( fd == -1 )
+    {
+        perror( "Error reading file" );
+        success = FALSE;
+    }
+    else
+    {
+        if ( fstat( fd, &info ) == -1 )
+        {
+            perror( "Error reading file" );
+            success = FALSE;
+        }
+        /* an empty file cannot be mapped, but also has nothing to parse */
+        else if ( info.st_size > 0 )
+        {
+            void *map = mmap( NULL, ( size_t )info.st_size, PROT_READ,
+                                MAP_PRIVATE, fd, 0 );
+            if ( map == MAP_FAILED )
+            {
+                perror( "Error while reading from file" );
+                success = FALSE;
+            }
+            else
+            {
+                guide->text = ( char* )map;
+                guide->textSize = ( long )info.st_size;
+
+                /* the file is read front to back exactly once */
+                posix_madvise( map, ( size_t )info.st_size,
+                                    POSIX_MADV_SEQUENTIAL );
+
+                success = processMapped( guide, threads, dayCode );
+
+                /* the titles were interned, so the text is not needed */
+                munmap( guide->text, ( size_t )guide->textSize );
+                guide->text = NULL;
+            }
+        }
+
+        /* the mapping stays valid after the file is closed */
+        close( fd );
+    }
+
+    if ( !success )
+    {
+        freeMappedGuide( guide );
+    }
+
+    return success;
+}
+
+
+
+
+/* NAME: freeMappedGuide
+ * PURPOSE: Release the entries, titles and any file mapping held by a
+ *          guide.
+ * IMPORTS: [ MappedGuide* ] guide: the guide to release
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: guide was filled in by readMappedFile().
+ *  POST: guide holds no mapping, entries or titles.
+ * REMARKS: Safe to call on a guide that has already been freed. */
+
+void freeMappedGuide( MappedGuide *guide )
+{
+    free( guide->entries );
+    guide->entries = NULL;
+    guide->length = 0;
+    freeTitlePool( &guide->titles );
+
+    if ( guide->text != NULL )
+    {
+        munmap( guide->text, ( size_t )guide->textSize );
+    }
+    guide->text = NULL;
+    guide->textSize = 0;
+}
+
+
+
+
+/* NAME: processMapped
+ * PURPOSE: Parse a mapped file's contents into an array of TVEntry,
+ *          ensuring that all data makes logical sense, optionally splitting
+ *          the text into chunks that are parsed by several threads.
+ * IMPORTS: [ MappedGuide* ] guide: holds the mapped text to parse, and
+ *          receives the parsed entries
+ *          [ int ] threads: the amount of threads to parse with
+ *          [ int ] dayCode: getDay() code of the only day to store, or 0
+ *          to store every day
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: guide->text holds guide->textSize bytes.
+ *  POST: guide->entries holds every entry of the text in file order OR an
+ *        appropriate error has been output.
+ * REMARKS: Helper function to readMappedFile(). Errors are the same as the
+ *          ones processFile() gives, and the error output is always for the
+ *          first failing record in the file, whatever chunk it was in.
+ *          A chunk is only used if the chunk before it stopped exactly where
+ *          it started, otherwise the rest of the text is parsed again by
+ *          this thread, so a title that looks like a day and time line can
+ *          only slow the parse down, never change its result. */
+
+int processMapped( MappedGuide *guide, int threads, int dayCode )
+{
+    int success = TRUE, used, ii, total = 0;
+    ParseChunk chunks[MAX_THREADS];
+    pthread_t workers[MAX_THREADS];
+
+    /* tiny files are not worth starting threads for */
+    if ( threads > MAX_THREADS )
+    {
+        threads = MAX_THREADS;
+    }
+    if ( ( long )threads * MIN_CHUNK_SIZE > guide->textSize )
+    {
+        threads = ( int )( guide->textSize / MIN_CHUNK_SIZE );
+    }
+    if ( threads < 1 )
+    {
+        threads = 1;
+    }
+
+    /* split the text evenly, then move each split forward to the start of
+     * a record. Each chunk parses the records that start before the next */
+    for ( ii = 0; ii < threads; ii++ )
+    {
+        chunks[ii].text = guide->text;
+        chunks[ii].textSize = guide->textSize;
+        chunks[ii].dayCode = dayCode;
+        chunks[ii].threaded = FALSE;
+        chunks[ii].start = ( ii == 0 ) ? 0 : findRecordStart( guide->text,
+                guide->textSize, guide->textSize / threads * ii );
+        if ( ( ii > 0 ) && ( chunks[ii].start < chunks[ii - 1].start ) )
+        {
+            chunks[ii].start = chunks[ii - 1].start;
+        }
+    }
+    for ( ii = 0; ii < threads; ii++ )
+    {
+        chunks[ii].end = ( ii + 1 < threads ) ? chunks[ii + 1].start :
+                                                    guide->textSize;
+    }
+
+    /* chunk 0 is parsed by this thread while the others are in workers */
+    for ( ii = 1; ii < threads; ii++ )
+    {
+        if ( pthread_create( &workers[ii], NULL, parseChunk, &chunks[ii] )
+                    != 0 )
+        {
+            /* any chunk that cannot get a thread is parsed here instead */
+            parseChunk( &chunks[ii] );
+        }
+        else
+        {
+            chunks[ii].threaded = TRUE;
+        }
+    }
+    parseChunk( &chunks[0] );
+    for ( ii = 1; ii < threads; ii++ )
+    {
+        if ( chunks[ii].threaded )
+        {
+            pthread_join( workers[ii], NULL );
+        }
+    }
+
+    /* walk the chunks in file order, using each one that lines up with the
+     * one before it, and stop at the first failure */
+    used = 0;
+    while ( ( used < threads ) && ( success ) )
+    {
+        if ( chunks[used].status != PARSE_OK )
+        {
+            reportParseError( chunks[used].status );
+            success = FALSE;
+        }
+        else
+        {
+            total += chunks[used].entries.length;
+
+            /* the next chunk started somewhere that is not a record, so
+             * discard it and every later chunk, and parse from here */
+            if ( ( used + 1 < threads ) &&
+                    ( chunks[used].stop != chunks[used + 1].start ) )
+            {
+                for ( ii = used + 1; ii < threads; ii++ )
+                {
+                    freeVector( &chunks[ii].entries );
+                    freeTitlePool( &chunks[ii].titles );
+                }
+                threads = used + 2;
+                chunks[used + 1].start = chunks[used].stop;
+                chunks[used + 1].end = guide->textSize;
+                parseChunk( &chunks[used + 1] );
+            }
+        }
+        used++;
+    }
+
+    if ( success )
+    {
+        success = mergeChunks( guide, chunks, threads, total );
+    }
+
+    for ( ii = 0; ii < threads; ii++ )
+    {
+        freeVector( &chunks[ii].entries );
+        freeTitlePool( &chunks[ii].titles );
+    }
+
+    return success;
+}
+
+
+
+
+/* NAME: mergeChunks
+ * PURPOSE: Concatenate the entries of every chunk in file order, and merge
+ *          the chunks' title pools into one.
+ * IMPORTS: [ MappedGuide* ] guide: receives the entries and titles
+ *          [ ParseChunk* ] chunks: the chunks that were parsed
+ *          [ int ] threads: the amount of chunks to merge
+ *          [ int ] total: the amount of entries across the chunks
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: Every chunk parsed successfully, and each one starts where the one
+ *       before it stopped.
+ *  POST: guide holds every entry, with IDs from guide's own pool, OR an
+ *        appropriate error has been output.
+ * REMARKS: Helper function to processMapped(). The first chunk's entries
+ *          and pool are taken over as they are, so only the few distinct
+ *          titles of the other chunks are interned again, and their entries
+ *          given the new IDs. */
+
+int mergeChunks( MappedGuide *guide, ParseChunk *chunks, int threads,
+                    int total )
+{
+    int success, ii, jj;
+    unsigned int *ids;
+    ParseChunk *chunk;
+    TVEntry entry;
+
+    /* the other chunks are added onto the end of the first chunk's own
+     * entries and titles, which are then handed off to the guide */
+    Vector *merged = &chunks[0].entries;
+    guide->titles = chunks[0].titles;
+    initTitlePool( &chunks[0].titles );
+
+    success = reserveVector( merged, total );
+
+    for ( ii = 1; ( ii < threads ) && ( success ); ii++ )
+    {
+        chunk = &chunks[ii];
+
+        /* ids maps an ID of the chunk's pool to its ID in guide's */
+        ids = ( unsigned int* )malloc( ( chunk->titles.count + 1 ) *
+                                            sizeof ( unsigned int ) );
+        if ( ids == NULL )
+        {
+            success = FALSE;
+        }
+        for ( jj = 0; ( success ) &&
+                ( jj < ( int )chunk->titles.count ); jj++ )
+        {
+            success = internTitle( &guide->titles,
+                    getTitle( &chunk->titles, ( unsigned int )jj ),
+                    getTitleLength( &chunk->titles, ( unsigned int )jj ),
+                    &ids[jj] );
+        }
+
+        /* room was reserved for every entry, so pushing cannot fail */
+        for ( jj = 0; ( success ) && ( jj < chunk->entries.length ); jj++ )
+        {
+            entry = ( ( TVEntry* )chunk->entries.data )[jj];
+            entry.title = ids[entry.title];
+            pushVector( merged, &entry );
+        }
+        free( ids );
+    }
+
+    if ( success )
+    {
+        guide->length = merged->length;
+        guide->entries = ( TVEntry* )releaseVector( merged );
+    }
+    else
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: parseChunk
+ * PURPOSE: Parse every record that starts within one chunk of the text into
+ *          the chunk's own array of TVEntry.
+ * IMPORTS: [ void* ] arg: the ParseChunk to parse
+ * EXPORTS: [ void* ] NULL, results are stored in the chunk
+ * ASSERTIONS
+ *  PRE: arg points to a ParseChunk with text, textSize, start and end set.
+ *  POST: The chunk's entries, titles, status and stop are set.
+ * REMARKS: Has the signature of a pthread start routine so it can be run on
+ *          a worker thread. Nothing is output from here, so that only the
+ *          error of the first failing chunk in file order is output. */
+
+void* parseChunk( void *arg )
+{
+    ParseChunk *chunk = ( ParseChunk* )arg;
+    const char *text = chunk->text;
+    const char *newline = text + chunk->start;
+    const char *end = text + chunk->end;
+    long lines = 1, pos = chunk->start;
+    const char *title;
+    int length, capacity;
+    TVEntry entry;
+
+    chunk->status = PARSE_OK;
+    initVector( &chunk->entries, sizeof ( TVEntry ) );
+    initTitlePool( &chunk->titles );
+
+    /* every entry takes up 2 lines, so counting newlines gives an upper
+     * bound to reserve rather than growing the vector while parsing */
+    while ( ( newline < end ) && ( ( newline = memchr( newline, '\n',
+                    ( size_t )( end - newline ) ) ) != NULL ) )
+    {
+        lines++;
+        newline++;
+    }
+
+    /* when only one day is stored, only start with room for a day's worth
+     * so that memory stays in proportion to the entries kept. The vector
+     * still grows if the days were not spread evenly */
+    capacity = ( int )( lines / 2 + 1 );
+    if ( chunk->dayCode != 0 )
+    {
+        capacity = capacity / 7 + 1;
+    }
+
+    if ( !reserveVector( &chunk->entries, capacity ) )
+    {
+        chunk->status = PARSE_NO_MEMORY;
+    }
+
+    /* parse record after record until the chunk or a record fails */
+    while ( ( pos < chunk->end ) && ( chunk->status == PARSE_OK ) )
+    {
+        chunk->status = parseRecord( text, chunk->textSize, &pos, &entry,
+                                        &title, &length );
+
+        /* an entry on another day is skipped, and its title is never
+         * interned */
+        if ( ( chunk->status == PARSE_OK ) && ( ( chunk->dayCode == 0 ) ||
+                    ( entry.day == chunk->dayCode ) ) )
+        {
+            if ( ( !internTitle( &chunk->titles, title, length,
+                                    &entry.title ) ) ||
+                    ( !pushVector( &chunk->entries, &entry ) ) )
+            {
+                chunk->status = PARSE_NO_MEMORY;
+            }
+        }
+    }
+    chunk->stop = pos;
+
+    return NULL;
+}
+
+
+
+
+/* NAME: findRecordStart
+ * PURPOSE: Find the first record that starts at or after some position.
+ * IMPORTS: [ const char* ] text: the text being parsed
+ *          [ long ] textSize: the amount of chars in text
+ *          [ long ] pos: the position to search from
+ * EXPORTS: [ long ] start: index of the first char of the record found, or
+ *          textSize if no record was found
+ * ASSERTIONS
+ *  PRE: pos is between 0 and textSize.
+ *  POST: start is the start of a line at or after pos.
+ * REMARKS: A record is a title line followed by a day and time line, so a
+ *          day and time line means the record starts on the next line, and
+ *          otherwise the record starts on the line before a day and time
+ *          line. This is a guess, as a title could read like a day and time,
+ *          so processMapped() checks that the chunks line up. */
+
+long findRecordStart( const char *text, long textSize, long pos )
+{
+    const char *end = text + textSize;
+    const char *line, *lineEnd, *next, *nextEnd;
+    long start = -1;
+    int day, hour, minute;
+
+    /* move to the start of the line after pos, unless pos is one already */
+    line = text + pos;
+    if ( ( pos > 0 ) && ( text[pos - 1] != '\n' ) )
+    {
+        line = memchr( line, '\n', ( size_t )( end - line ) );
+        line = ( line == NULL ) ? end : line + 1;
+    }
+
+    while ( ( start == -1 ) && ( line < end ) )
+    {
+        lineEnd = memchr( line, '\n', ( size_t )( end - line ) );
+        lineEnd = ( lineEnd == NULL ) ? end : lineEnd;
+        next = ( lineEnd < end ) ? lineEnd + 1 : end;
+
+        if ( ( scanTimeLine( line, lineEnd, &day, &hour, &minute ) == 3 ) &&
+                ( day != 0 ) )
+        {
+            start = next - text;
+        }
+        else if ( next < end )
+        {
+            nextEnd = memchr( next, '\n', ( size_t )( end - next ) );
+            nextEnd = ( nextEnd == NULL ) ? end : nextEnd;
+            if ( ( scanTimeLine( next, nextEnd, &day, &hour,
+                                    &minute ) == 3 ) && ( day != 0 ) )
+            {
+                start = line - text;
+            }
+        }
+        line = next;
+    }
+
+    if ( start == -1 )
+    {
+        start = textSize;
+    }
+    return start;
+}
+
+
+
+
+/* NAME: parseRecord
+ * PURPOSE: Parse the title line and day/time line of one entry in place.
+ * IMPORTS: [ const char* ] text: the text being parsed
+ *          [ long ] textSize: the amount of chars in text
+ *          [ long* ] pos: index of the entry's first char, which is moved
+ *          past the end of the entry
+ *          [ TVEntry* ] entry: structure to store the day and time into
+ *          [ const char** ] title: where to store the first char of the
+ *          title, within text
+ *          [ int* ] length: where to store the amount of chars in the title
+ * EXPORTS: [ int ] status: PARSE_OK, or the PARSE_ error found first
+ * ASSERTIONS
+ *  PRE: *pos is less than textSize and is the start of a title line.
+ *  POST: entry, title and length hold the parsed entry OR status gives the
+ *        error. The entry's title ID is left for the caller to intern.
+ * REMARKS: Checks are done in the same order as processFile() does them,
+ *          so the same error is found for the same record. That includes a
+ *          title too long for processFile()'s line buffer, which is
+ *          rejected the same as it is there. */
+
+int parseRecord( const char *text, long textSize, long *pos,
+                    TVEntry *entry, const char **title, int *length )
+{
+    int status = PARSE_OK, day = 0, hour = 0, minute = 0;
+    const char *end = text + textSize;
+    const char *titleEnd, *line, *lineEnd;
+
+    *title = text + *pos;
+    titleEnd = memchr( *title, '\n', ( size_t )( end - *title ) );
+    if ( titleEnd == NULL )
+    {
+        titleEnd = end;
+    }
+
+    /* an empty title is a line that is only its newline */
+    if ( titleEnd == *title )
+    {
+        status = PARSE_EMPTY_TITLE;
+    }
+    /* fgets() in processFile() reads at most LINE_SIZE - 1 chars, so a
+     * longer title leaves the rest of its line, or just its newline, to be
+     * scanned as the day and time */
+    else if ( ( titleEnd - *title > LINE_SIZE - 2 ) &&
+                ( *title + LINE_SIZE - 1 < end ) )
+    {
+        status = PARSE_BAD_SCAN;
+    }
+    /* the title must be followed by a line holding the day and time */
+    else if ( titleEnd + 1 >= end )
+    {
+        status = PARSE_NO_TIME_LINE;
+    }
+    else
+    {
+        line = titleEnd + 1;
+        lineEnd = memchr( line, '\n', ( size_t )( end - line ) );
+        if ( lineEnd == NULL )
+        {
+            lineEnd = end;
+        }
+
+        /* the next entry starts after this line's newline */
+        *pos = ( lineEnd - text ) + 1;
+
+        /* Require scans for day, hour, and minute */
+        if ( scanTimeLine( line, lineEnd, &day, &hour, &minute ) != 3 )
+        {
+            status = PARSE_BAD_SCAN;
+        }
+        /* scanTimeLine() sets a day code of 0 for an invalid day */
+        else if ( day == 0 )
+        {
+            status = PARSE_BAD_DAY;
+        }
+        /* otherwise check hour and minute being correct values */
+        else if ( ( hour < 0 ) || ( hour > 23 ) ||
+                    ( minute < 0 ) || ( minute > 59 ) )
+        {
+            status = PARSE_BAD_TIME;
+        }
+        /* the title is given back to be interned by the caller */
+        else
+        {
+            *length = ( int )( titleEnd - *title );
+            entry->day = ( unsigned char )day;
+            entry->key = ( unsigned short )( ( day - 1 ) * MINUTES_PER_DAY +
+                                                hour * 60 + minute );
+        }
+    }
+    return status;
+}
+
+
+
+
+/* NAME: scanTimeLine
+ * PURPOSE: Decode a "Day HH:MM" line directly from the text it is in.
+ * IMPORTS: [ const char* ] line: first char of the line
+ *          [ const char* ] end: one past the last char of the line
+ *          [ int* ] day: where to store the day code
+ *          [ int* ] hour: where to store the hour
+ *          [ int* ] minute: where to store the minute
+ * EXPORTS: [ int ] scans: the amount of fields decoded, from 0 to 3
+ * ASSERTIONS
+ *  PRE: line to end does not include the newline.
+ *  POST: scans gives the same count as sscanf( line, "%s %d:%d", ... ) in
+ *        processFile() would, with the fields decoded stored.
+ * REMARKS: The day is stored as a code from getDayToken(), so it is 0 when
+ *          the day was scanned but is not a day of the week. */
+
+int scanTimeLine( const char *line, const char *end, int *day, int *hour,
+                    int *minute )
+{
+    int scans = 0;
+    const char *token;
+
+    /* "%s" skips whitespace and then reads up to the next whitespace */
+    while ( ( line < end ) && isspace( ( unsigned char )*line ) )
+    {
+        line++;
+    }
+    token = line;
+    while ( ( line < end ) && !isspace( ( unsigned char )*line ) )
+    {
+        line++;
+    }
+
+    if ( line > token )
+    {
+        *day = getDayToken( token, ( int )( line - token ) );
+        scans = 1;
+
+        /* "%d:%d" needs a colon directly after the hour */
+        if ( scanNumber( &line, end, hour ) )
+        {
+            scans = 2;
+            if ( ( line < end ) && ( *line == ':' ) )
+            {
+                line++;
+                if ( scanNumber( &line, end, minute ) )
+                {
+                    scans = 3;
+                }
+            }
+        }
+    }
+    return scans;
+}
+
+
+
+
+/* NAME: scanNumber
+ * PURPOSE: Decode a decimal integer the same way "%d" in sscanf() does.
+ * IMPORTS: [ const char** ] str: the position to read from, which is moved
+ *          past the number
+ *          [ const char* ] end: one past the last char that can be read
+ *          [ int* ] number: where to store the decoded number
+ * EXPORTS: [ int ] found: TRUE if a number was decoded, otherwise FALSE
+ * ASSERTIONS
+ *  PRE: *str is less than or equal to end.
+ *  POST: number holds the decoded number if found is TRUE.
+ * REMARKS: Leading whitespace and a sign are accepted like "%d". Numbers too
+ *          big for an int stop growing, as they are invalid times anyway. */
+
+int scanNumber( const char **str, const char *end, int *number )
+{
+    int found = FALSE, negative = FALSE, value = 0;
+    const char *ch = *str;
+
+    while ( ( ch < end ) && isspace( ( unsigned char )*ch ) )
+    {
+        ch++;
+    }
+    if ( ( ch < end ) && ( ( *ch == '-' ) || ( *ch == '+' ) ) )
+    {
+        negative = ( *ch == '-' );
+        ch++;
+    }
+
+    while ( ( ch < end ) && isdigit( ( unsigned char )*ch ) )
+    {
+        if ( value < 100000 )
+        {
+            value = value * 10 + ( *ch - '0' );
+        }
+        found = TRUE;
+        ch++;
+    }
+
+    if ( found )
+    {
+        *number = negative ? -value : value;
+        *str = ch;
+    }
+    return found;
+}
+
+
+
+
+/* NAME: reportParseError
+ * PURPOSE: Output the error message for a failed parse of a record.
+ * IMPORTS: [ int ] status: the PARSE_ error that occurred
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: status is not PARSE_OK.
+ *  POST: A relevant error message has been output.
+ * REMARKS: Messages match the ones output by processFile(). A title with
+ *          no day and time gets the perror() that processFile() gives when
+ *          fgets() reaches the end of the file, where errno is still 0. */
+
+void reportParseError( int status )
+{
+    if ( status == PARSE_EMPTY_TITLE )
+    {
+        fprintf( stderr, "Error: File has empty title field!\n");
+    }
+    else if ( status == PARSE_NO_TIME_LINE )
+    {
+        errno = 0;
+        perror( "Error while reading from file" );
+    }
+    else if ( status == PARSE_BAD_SCAN )
+    {
+        fprintf( stderr, "Error: Could not scan in file parameters!\n" );
+    }
+    else if ( status == PARSE_BAD_DAY )
+    {
+        fprintf( stderr, "Error: Incorrect day in file!\n" );
+    }
+    else if ( status == PARSE_BAD_TIME )
+    {
+        fprintf( stderr, "Error: Incorrect time in file!\n" );
+    }
+    else if ( status == PARSE_NO_MEMORY )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+}
@@ -0,0 +1,415 @@
+/* FILE: filter.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Filter an array of TV guide entries down to the entries of a day,
+ *          or index where each day's entries are.
+ * REFERENCE: https://stackoverflow.com/a/26226613; M.M's answer
+ * LAST MOD: 17/10/2026
+ * COMMENTS: Moved out of tvguide.c so that Benchmark can time it as well.
+ *           The SSE2 and AVX2 kernels are GCC specific, and are left out
+ *           when built with anything else, leaving the scalar kernel.
+ */
+
+
+#include "filter.h"
+
+
+/* the vector kernels use GCC's intrinsics and CPU checks on x86 */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define FILTER_SIMD
+#include <immintrin.h>
+#endif
+
+
+static int matchScalar( const unsigned char *days, int dayCode, int ii,
+                            int kept, int length, int *matches );
+#ifdef FILTER_SIMD
+static int matchSSE2( const unsigned char *days, int dayCode, int length,
+                        int *matches );
+static int matchAVX2( const unsigned char *days, int dayCode, int length,
+                        int *matches );
+#endif
+
+
+
+
+/* NAME: filter
+ * PURPOSE: Take an array and filter the array so that only the day the user
+ *          selected is present in the array.
+ * IMPORTS: [ TVEntry* ] array: the array dynamically created in processArgs()
+ *          [ int ] dayCode: the code of the user's choice of day for
+ *          filtering, as given by getDay()
+ *          [ int ] arraySize: the size of the array passed
+ * EXPORTS: [ int ] jj: a counter for the amount of array indexes that match
+ *                      the desired filter; effectively becomes the new array
+ *                      size in the caller
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array
+ *       dayCode is between 1-7 inclusive
+ *       array is not empty 
+ *  POST: jj will represent the new arraySize
+ *        array will contain the filtered selection
+ * REMARKS: I could have used realloc() instead, but there is no certainty 
+ * that the function would free() the memory to the OS (but rather for future
+ * malloc uses (which are not present in this program), and thus the realloc 
+ * has no real benefit as the array is free'd shortly after this function.
+ * See: https://stackoverflow.com/a/26226613, 2014; M.M's answer
+ *          Uses the fastest kernel the CPU running the program supports, as
+ *          given by bestFilterKernel(). */
+
+int filter( TVEntry *array, int dayCode, int arraySize )
+{
+    return filterWith( array, dayCode, arraySize, bestFilterKernel( ) );
+}
+
+
+
+
+/* NAME: bestFilterKernel
+ * PURPOSE: Find the fastest filter kernel the CPU running the program
+ *          supports.
+ * IMPORTS: void
+ * EXPORTS: [ int ] kernel: FILTER_AVX2, FILTER_SSE2 or FILTER_SCALAR
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: kernel can be given to filterWith() on this CPU.
+ * REMARKS: Checked when the program runs rather than when it is compiled,
+ *          so one binary uses AVX2 where there is AVX2 and still runs on
+ *          older CPUs. */
+
+int bestFilterKernel( void )
+{
+    int kernel = FILTER_SCALAR;
+
+#ifdef FILTER_SIMD
+    if ( __builtin_cpu_supports( "avx2" ) )
+    {
+        kernel = FILTER_AVX2;
+    }
+    else if ( __builtin_cpu_supports( "sse2" ) )
+    {
+        kernel = FILTER_SSE2;
+    }
+#endif
+
+    return kernel;
+}
+
+
+
+
+/* NAME: filterWith
+ * PURPOSE: Same as filter(), with a given kernel.
+ * IMPORTS: [ TVEntry* ] array: the array to filter
+ *          [ int ] dayCode: the code of the day to keep, as given by getDay()
+ *          [ int ] arraySize: the size of the array passed
+ *          [ int ] kernel: FILTER_SCALAR, FILTER_SSE2 or FILTER_AVX2
+ * EXPORTS: [ int ] jj: the new array size, as from filter()
+ * ASSERTIONS
+ *  PRE: The same as filter(), and the CPU supports kernel.
+ *  POST: The same as filter().
+ * REMARKS: The array is filtered FILTER_BLOCK entries at a time. The day
+ *          codes of a block are copied into a column of their own, which
+ *          the kernel matches into a list of the indexes kept, and those
+ *          entries are then copied down. Both lists stay in cache, and the
+ *          kernel compares 16 or 32 day codes per instruction rather than
+ *          the 2 or 4 it gets loading whole entries. Entries only move
+ *          forwards, so none is overwritten before it is copied, and they
+ *          stay in the order they were in. Given a kernel so Benchmark can
+ *          time and check each of them. */
+
+int filterWith( TVEntry *array, int dayCode, int arraySize, int kernel )
+{
+    int jj = 0, start, length, kept, kk;
+    unsigned char days[FILTER_BLOCK];
+    int matches[FILTER_BLOCK + 1];
+
+    for ( start = 0; start < arraySize; start += FILTER_BLOCK )
+    {
+        length = arraySize - start;
+        if ( length > FILTER_BLOCK )
+        {
+            length = FILTER_BLOCK;
+        }
+
+        dayColumn( array + start, length, days );
+        kept = matchDays( days, dayCode, length, matches, kernel );
+        for ( kk = 0; kk < kept; kk++ )
+        {
+            array[jj] = array[start + matches[kk]];
+            jj++;
+        }
+    }
+
+    return jj;
+}
+
+
+
+
+/* NAME: dayColumn
+ * PURPOSE: Copy the day codes of an array of entries into a column of
+ *          their own.
+ * IMPORTS: [ const TVEntry* ] array: the entries to take the days of
+ *          [ int ] arraySize: the size of the array passed
+ *          [ unsigned char* ] days: where to store the day codes
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: days has room for arraySize codes.
+ *  POST: days[ii] is the day code of array[ii].
+ * REMARKS: One byte per entry, so matchDays() gets 8 times as many day
+ *          codes per load as from the entries themselves. */
+
+void dayColumn( const TVEntry *array, int arraySize, unsigned char *days )
+{
+    int ii;
+
+    for ( ii = 0; ii < arraySize; ii++ )
+    {
+        days[ii] = array[ii].day;
+    }
+}
+
+
+
+
+/* NAME: matchDays
+ * PURPOSE: List the indexes of a column of day codes that hold a given day.
+ * IMPORTS: [ const unsigned char* ] days: the column, from dayColumn()
+ *          [ int ] dayCode: the code of the day to match
+ *          [ int ] length: the amount of codes in days
+ *          [ int* ] matches: where to store the indexes matched
+ *          [ int ] kernel: FILTER_SCALAR, FILTER_SSE2 or FILTER_AVX2
+ * EXPORTS: [ int ] kept: the amount of indexes stored in matches
+ * ASSERTIONS
+ *  PRE: matches has room for length + 1 indexes. The CPU supports kernel.
+ *  POST: matches holds the indexes of days equal to dayCode, in order.
+ * REMARKS: Every kernel gives the same list, the scalar one is used if the
+ *          others are not built in. */
+
+int matchDays( const unsigned char *days, int dayCode, int length,
+                int *matches, int kernel )
+{
+    int kept;
+
+#ifdef FILTER_SIMD
+    if ( kernel == FILTER_AVX2 )
+    {
+        kept = matchAVX2( days, dayCode, length, matches );
+    }
+    else if ( kernel == FILTER_SSE2 )
+    {
+        kept = matchSSE2( days, dayCode, length, matches );
+    }
+    else
+    {
+        kept = matchScalar( days, dayCode, 0, 0, length, matches );
+    }
+#else
+    kept = matchScalar( days, dayCode, 0, 0, length, matches );
+#endif
+
+    return kept;
+}
+
+
+
+
+/* NAME: matchScalar
+ * PURPOSE: Match part of a column of day codes one code at a time.
+ * IMPORTS: [ const unsigned char* ] days: the column to match
+ *          [ int ] dayCode: the code of the day to match
+ *          [ int ] ii: the index to start matching from
+ *          [ int ] kept: the amount of indexes already matched before ii
+ *          [ int ] length: the amount of codes in days
+ *          [ int* ] matches: where to store the indexes matched
+ * EXPORTS: [ int ] kept: the amount of indexes matched in the whole column
+ * ASSERTIONS
+ *  PRE: The first kept indexes of matches are the ones matched before ii.
+ *  POST: matches holds every index matched.
+ * REMARKS: Also finishes off the codes left over at the end of the column
+ *          by the vector kernels. Every index is stored and only the
+ *          matching ones counted, as a branch per code would be
+ *          mispredicted about as often as not on a guide sorted by name,
+ *          which is why matches needs room for one more. */
+
+int matchScalar( const unsigned char *days, int dayCode, int ii, int kept,
+                    int length, int *matches )
+{
+    for ( ; ii < length; ii++ )
+    {
+        matches[kept] = ii;
+        kept += ( days[ii] == dayCode );
+    }
+
+    return kept;
+}
+
+
+
+
+#ifdef FILTER_SIMD
+/* NAME: matchSSE2
+ * PURPOSE: Match a column of day codes 16 codes at a time, with SSE2.
+ * IMPORTS: [ const unsigned char* ] days: the column to match
+ *          [ int ] dayCode: the code of the day to match
+ *          [ int ] length: the amount of codes in days
+ *          [ int* ] matches: where to store the indexes matched
+ * EXPORTS: [ int ] kept: the amount of indexes matched
+ * ASSERTIONS
+ *  PRE: matches has room for length + 1 indexes.
+ *  POST: matches holds every index matched.
+ * REMARKS: 16 codes are compared in one instruction, giving a mask with a
+ *          bit per code. A mask of 0, which is most of them on a guide
+ *          sorted by time, is passed over on one test, otherwise each set
+ *          bit is taken off the bottom of the mask in turn, so the loop only
+ *          runs once per index matched. */
+
+int matchSSE2( const unsigned char *days, int dayCode, int length,
+                int *matches )
+{
+    int ii, kept = 0;
+    unsigned int bits;
+    __m128i code = _mm_set1_epi8( ( char )dayCode );
+
+    for ( ii = 0; ii + 16 <= length; ii += 16 )
+    {
+        bits = ( unsigned int )_mm_movemask_epi8( _mm_cmpeq_epi8( code,
+                    _mm_loadu_si128( ( const __m128i* )&days[ii] ) ) );
+
+        while ( bits != 0 )
+        {
+            matches[kept] = ii + __builtin_ctz( bits );
+            kept++;
+            bits &= bits - 1;
+        }
+    }
+
+    return matchScalar( days, dayCode, ii, kept, length, matches );
+}
+
+
+
+
+/* NAME: matchAVX2
+ * PURPOSE: Match a column of day codes 32 codes at a time, with AVX2.
+ * IMPORTS: [ const unsigned char* ] days: the column to match
+ *          [ int ] dayCode: the code of the day to match
+ *          [ int ] length: the amount of codes in days
+ *          [ int* ] matches: where to store the indexes matched
+ * EXPORTS: [ int ] kept: the amount of indexes matched
+ * ASSERTIONS
+ *  PRE: matches has room for length + 1 indexes. The CPU supports AVX2.
+ *  POST: matches holds every index matched.
+ * REMARKS: The same as matchSSE2(), on 32 codes per instruction. Compiled
+ *          for AVX2 on its own, so the rest of the program does not need
+ *          it. */
+
+__attribute__(( target( "avx2" ) ))
+int matchAVX2( const unsigned char *days, int dayCode, int length,
+                int *matches )
+{
+    int ii, kept = 0;
+    unsigned int bits;
+    __m256i code = _mm256_set1_epi8( ( char )dayCode );
+
+    for ( ii = 0; ii + 32 <= length; ii += 32 )
+    {
+        bits = ( unsigned int )_mm256_movemask_epi8( _mm256_cmpeq_epi8( code,
+                    _mm256_loadu_si256( ( const __m256i* )&days[ii] ) ) );
+
+        while ( bits != 0 )
+        {
+            matches[kept] = ii + __builtin_ctz( bits );
+            kept++;
+            bits &= bits - 1;
+        }
+    }
+
+    return matchScalar( days, dayCode, ii, kept, length, matches );
+}
+#endif
+
+
+
+
+/* NAME: indexDays
+ * PURPOSE: Put an array of entries in day order, and record where each
+ *          day's entries start, so any day can be taken without a filter.
+ * IMPORTS: [ TVEntry* ] array: the array to index
+ *          [ int ] arraySize: the size of the array passed
+ *          [ DayIndex* ] index: where to record each day's start
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array. Every entry has a day code
+ *       from 1 to 7.
+ *  POST: array is grouped by day, monday first, and index holds where each
+ *        day starts OR an error is output and array is left unchanged.
+ * REMARKS: A counting sort on the day code, so 2 passes over the array.
+ *          Entries of the same day stay in the order they were in, so
+ *          sorting a day's entries afterwards gives the same order as
+ *          sorting every entry and filtering them would. */
+
+int indexDays( TVEntry *array, int arraySize, DayIndex *index )
+{
+    int success = TRUE, ii, next[DAYS_PER_WEEK];
+    TVEntry *grouped = NULL;
+
+    memset( index->start, 0, sizeof ( index->start ) );
+
+    /* count each day, offset by one so the sums below give starts */
+    for ( ii = 0; ii < arraySize; ii++ )
+    {
+        index->start[array[ii].day]++;
+    }
+    for ( ii = 1; ii <= DAYS_PER_WEEK; ii++ )
+    {
+        index->start[ii] += index->start[ii - 1];
+    }
+
+    if ( arraySize > 1 )
+    {
+        grouped = ( TVEntry* )malloc( ( size_t )arraySize *
+                                        sizeof ( TVEntry ) );
+        if ( grouped == NULL )
+        {
+            fprintf( stderr, "Error: Memory not assigned!\n" );
+            success = FALSE;
+        }
+        else
+        {
+            memcpy( next, index->start, sizeof ( next ) );
+            for ( ii = 0; ii < arraySize; ii++ )
+            {
+                grouped[next[array[ii].day - 1]++] = array[ii];
+            }
+            memcpy( array, grouped, ( size_t )arraySize *
+                                        sizeof ( TVEntry ) );
+            free( grouped );
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: daySegment
+ * PURPOSE: Take the entries of one day from an array indexed by day.
+ * IMPORTS: [ TVEntry* ] array: the array indexed by indexDays()
+ *          [ const DayIndex* ] index: the index of the array
+ *          [ int ] dayCode: the day to take, as given by getDay()
+ *          [ int* ] length: where to store the amount of entries of the day
+ * EXPORTS: [ TVEntry* ] segment: the first entry of the day
+ * ASSERTIONS
+ *  PRE: dayCode is between 1-7 inclusive.
+ *  POST: segment holds *length entries, all of the day.
+ * REMARKS: O(1), nothing is copied or compared. */
+
+TVEntry* daySegment( TVEntry *array, const DayIndex *index, int dayCode,
+                        int *length )
+{
+    *length = index->start[dayCode] - index->start[dayCode - 1];
+    return array + index->start[dayCode - 1];
+}
@@ -0,0 +1,58 @@
+/* FILE: filter.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef FILTER_H
+#define FILTER_H
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "data.h"
+#include "boolean.h"
+
+
+/* kernels filterWith() can filter with */
+#define FILTER_SCALAR 0
+#define FILTER_SSE2 1
+#define FILTER_AVX2 2
+
+/* the amount of entries filterWith() takes the day codes of at a time */
+#define FILTER_BLOCK 4096
+
+
+/* NAME: DayIndex
+ * PURPOSE: Record where each day's entries are, in an array that has been
+ *          put in day order by indexDays().
+ * FIELDS:  [ int [] ] start: index of the first entry of each day, indexed
+ *          by day code - 1, with start[DAYS_PER_WEEK] the size of the array
+ * REMARKS: The entries of a day run from its start to the next day's. */
+
+typedef struct {
+    int start[DAYS_PER_WEEK + 1];
+} DayIndex;
+
+
+int filter( TVEntry *array, int dayCode, int arraySize );
+int bestFilterKernel( void );
+int filterWith( TVEntry *array, int dayCode, int arraySize, int kernel );
+void dayColumn( const TVEntry *array, int arraySize, unsigned char *days );
+int matchDays( const unsigned char *days, int dayCode, int length,
+                int *matches, int kernel );
+int indexDays( TVEntry *array, int arraySize, DayIndex *index );
+TVEntry* daySegment( TVEntry *array, const DayIndex *index, int dayCode,
+                        int *length );
+
+
+
+#endif
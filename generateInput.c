@@ -3,7 +3,7 @@
  * UNIT: Unix and C Programming
  * PURPOSE: Generate test input for the TV guide formatting program.
  * REFERENCE: N/A
- * LAST MOD: 26/05/2018
+ * LAST MOD: 16/10/2026
  * COMMENTS: Data pool from randomlists.com's TV and movie show generator.
  */
 
@@ -21,17 +21,21 @@
  *          0 is used for success, 1 is used for all errors.
  * ASSERTIONS
  *  PRE: argv[1] should be a valid number (for number of entries).
+ *       argv[3], if given, should be a valid number (for the seed).
  *  POST: A file with correctly formatted TV guide entries should been output
  *        to the file specified in argv[2].
- * REMARKS: None */
+ * REMARKS: Without a seed, the time is used, so every file differs. With a
+ *          seed the same file is generated every time, which benchmarks
+ *          need so that their results can be compared. */
 
 int main( int argc, char *argv[] )
 {
     int status = 0;
-    if ( argc != 3 )
+    if ( ( argc != 3 ) && ( argc != 4 ) )
     {
         fprintf( stderr, "Error: Enter how many TV shows should be generated,"
-                            " and a filename where to store it\n" );
+                            " and a filename where to store it, optionally"
+                            " followed by a seed\n" );
         status = 1;
     }
     else
@@ -39,7 +43,15 @@ int main( int argc, char *argv[] )
         FILE *f;
         extern char *entryPool[ARRAY_LENGTH]; /* array hardcoded in header */
 
-        srand( ( unsigned )time( NULL ) ); /* seed for rand function */
+        /* seed for rand function */
+        if ( argc == 4 )
+        {
+            srand( ( unsigned )strtoul( argv[3], NULL, 10 ) );
+        }
+        else
+        {
+            srand( ( unsigned )time( NULL ) );
+        }
 
         f = fopen( argv[2], "w" );
         if ( f == NULL )
@@ -50,6 +62,7 @@ int main( int argc, char *argv[] )
         else
         {
             writeInputFile( entryPool, f, argv[1] );
+            fclose( f );
         }
     }
 
@@ -2,10 +2,10 @@
  * AUTHOR: Cameron Petkov
  * UNIT: Unix and C Programming
  * PURPOSE: Contains all functions that get input from the user 
- *          (inputStrings), give output to user (outputArray), and any helper
- *          functions (isValidDay, isValidSort).
+ *          (inputStrings, inputSort), give output to user (outputArray),
+ *          and any helper functions (isValidDay, isValidSort).
  * REFERENCE: https://stackoverflow.com/a/39421460, 2016, SO user "Kaz"
- * LAST MOD: 24/05/2018
+ * LAST MOD: 16/10/2026
  * COMMENTS: isValidDay/isValidSort functions are static because they are
  *           specific to the output from fgets() which attaches a '\n' char.
  */
@@ -59,6 +59,31 @@ int inputStrings( char day[DAY_SIZE], char sortType[SORT_SIZE] )
     decideFlush( day ); /* decide if stdin needs to be flushed */
     scanSuc = NULL;
 
+    inputSort( sortType );
+
+    return success;
+}
+
+
+
+
+/* NAME: inputSort
+ * PURPOSE: Reads in a valid sort type, reprompting the user if the input is
+ *          invalid.
+ * IMPORTS: [ char [] ] sortType: string to store a valid sort type into
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: sortType is of correct size and is empty
+ *  POST: sortType contains a valid option
+ * REMARKS: The second half of inputStrings(), on its own for queries, which
+ *          choose their entries some other way than by day. */
+
+int inputSort( char sortType[SORT_SIZE] )
+{
+    int success = TRUE;
+    char *scanSuc = NULL;
+
     printf( "Sort by \"time\" or \"name\"? \n" );
     scanSuc = fgets( sortType, SORT_SIZE, stdin );
     makeLower( sortType );
@@ -89,6 +114,8 @@ int inputStrings( char day[DAY_SIZE], char sortType[SORT_SIZE] )
  * IMPORTS: [ TVEntry* ] array: a usually sorted/filtered array containing
  *                              a pointer to a TVEntry structure
  *          [ int ] arraySize: the array size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
  * EXPORTS: [ int ] success: success or failure of the function
  *          FALSE (0) is used for failure, TRUE (!0) is used for success
  * ASSERTIONS
@@ -98,7 +125,7 @@ int inputStrings( char day[DAY_SIZE], char sortType[SORT_SIZE] )
  * REMARKS: A header/title for the day can be enabled by uncommenting the
  *          relevant section. */
 
-int outputArray( TVEntry *array, int arraySize )
+int outputArray( TVEntry *array, int arraySize, const TitlePool *titles )
 {
     int success = TRUE, ii;
 
@@ -117,11 +144,14 @@ int outputArray( TVEntry *array, int arraySize )
     }
     else
     {
-        /* otherwise loop through array and print in the specified format */
+        /* otherwise loop through array and print in the specified format,
+         * the title is printed up to and including its newline */
         for (ii = 0; ii < arraySize; ii++ )
         {
-            printf("%2d:%02d - %s",array[ii].time.hour, 
-                        array[ii].time.minute, array[ii].title );
+            printf("%2d:%02d - %.*s", ENTRY_HOUR( array[ii] ),
+                ENTRY_MINUTE( array[ii] ),
+                getTitleLength( titles, array[ii].title ) + 1,
+                getTitle( titles, array[ii].title ) );
         }
     }
     
@@ -3,7 +3,7 @@
  * UNIT: Unix and C Programming
  * PURPOSE: General header includes, definitions, and forward-declarations.
  * REFERENCE: N/A
- * LAST MOD: 24/05/2018
+ * LAST MOD: 16/10/2026
  * COMMENTS: None
  */
 
@@ -18,6 +18,7 @@
 #include <ctype.h>
 
 #include "data.h"
+#include "titlePool.h"
 #include "boolean.h"
 
 
@@ -27,7 +28,8 @@
 
 
 int inputStrings( char day[], char sortType[] );
-int outputArray( TVEntry *array, int arraySize );
+int inputSort( char sortType[SORT_SIZE] );
+int outputArray( TVEntry *array, int arraySize, const TitlePool *titles );
 int decideFlush( char inputString[] );
 int flushInput( void );
 int makeLower( char str[] );
@@ -3,7 +3,7 @@
  * UNIT: Unix and C Programming
  * PURPOSE: General header includes, definitions, and forward-declarations.
  * REFERENCE: N/A
- * LAST MOD: 24/05/2018
+ * LAST MOD: 17/10/2026
  * COMMENTS: None
  */
 
@@ -17,7 +17,7 @@
 #include <stdio.h>
 
 #include "data.h"
-#include "list.h"
+#include "vector.h"
 #include "interface.h"
 #include "comparison.h"
 
@@ -26,9 +26,58 @@
 #define NAME_SIZE 100
 #define DAY_SIZE 11
 
+/* chars of the "HH:MM - " each line of the guide starts with, and the
+ * ways formatGuideWith() can format it */
+#define PREFIX_SIZE 8
+#define PREFIX_SPRINTF 0
+#define PREFIX_TABLE 1
 
-int readFile( char filename[], LinkedList *list );
-int writeFile( char filename[], TVEntry *array, int arraySize );
+/* what writeGuide() outputs when there are no entries to write, for a day
+ * and for a query */
+#define EMPTY_DAY "No TV shows found on selected day."
+#define EMPTY_QUERY "No TV shows match the query."
+
+
+/* NAME: MappedGuide
+ * PURPOSE: Hold an input file that has been memory mapped, along with the
+ *          entries parsed from it in place.
+ * FIELDS:  [ char* ] text: the file's contents, as mapped into memory, or
+ *          NULL once parsing is finished
+ *          [ long ] textSize: the amount of bytes in the file
+ *          [ TVEntry* ] entries: array of the entries parsed from text
+ *          [ int ] length: the amount of entries in the array
+ *          [ TitlePool ] titles: the distinct titles of the entries
+ * REMARKS: The entries' titles are interned in titles, so the mapping is
+ *          released as soon as the file is parsed. The whole structure
+ *          should be released together with freeMappedGuide(). */
+
+typedef struct {
+    char *text;
+    long textSize;
+    TVEntry *entries;
+    int length;
+    TitlePool titles;
+} MappedGuide;
+
+
+int readFile( char filename[], Vector *entries, TitlePool *titles,
+                int dayCode );
+int writeFile( char filename[], TVEntry *array, int arraySize,
+                    const TitlePool *titles );
+int writeGuide( char filename[], TVEntry *array, int arraySize,
+                    const TitlePool *titles, const char *empty );
+int writeText( char filename[], const char *text, long size );
+int formatGuide( TVEntry *array, int arraySize, const TitlePool *titles,
+                    char **text, long *size );
+int formatGuideWith( TVEntry *array, int arraySize, const TitlePool *titles,
+                        char **text, long *size, int engine );
+long measureGuide( TVEntry *array, int arraySize, const TitlePool *titles );
+void fillGuide( TVEntry *array, int arraySize, const TitlePool *titles,
+                    char *text, int engine );
+int writeAll( int fd, const char *text, long size );
+int readMappedFile( char filename[], MappedGuide *guide, int threads,
+                        int dayCode );
+void freeMappedGuide( MappedGuide *guide );
 
 
 
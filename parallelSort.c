@@ -0,0 +1,369 @@
+/* FILE: parallelSort.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Sort an array of TVEntry structures on several threads, with any
+ *          of the comparison functions given to qsort().
+ * REFERENCE: Merge path, Odeh et al., "Merge Path - Parallel Merging Made
+ *            Simple", IPDPS Workshops 2012
+ * LAST MOD: 17/10/2026
+ * COMMENTS: Uses POSIX pthreads rather than C89 functions, so
+ *           _POSIX_C_SOURCE is defined before any includes.
+ */
+
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+
+#include "parallelSort.h"
+
+
+/* NAME: SortTask
+ * PURPOSE: Hold one thread's share of sorting or merging an array.
+ * FIELDS:  [ TVEntry* ] array: the entries read from
+ *          [ TVEntry* ] merged: where merged entries are written to
+ *          [ int ] start: index of the first entry of the first run
+ *          [ int ] middle: index of the first entry of the second run
+ *          [ int ] end: index one past the last entry of the second run
+ *          [ int ] first: the first place in the merged runs, counting from
+ *          start, this task writes to
+ *          [ int ] last: one past the last place this task writes to
+ *          [ int (*)( const void*, const void* ) ] compare: the order to
+ *          sort in
+ *          [ int ] threaded: TRUE if the task was given a thread of its own
+ * REMARKS: Private to this file. A sort task sorts array from start to end
+ *          in place, and only uses start, end and compare. */
+
+typedef struct {
+    TVEntry *array;
+    TVEntry *merged;
+    int start;
+    int middle;
+    int end;
+    int first;
+    int last;
+    int ( *compare )( const void*, const void* );
+    int threaded;
+} SortTask;
+
+
+static int splitPoint( int size, int parts, int part );
+static void runTasks( SortTask *tasks, int count,
+                        void* ( *routine )( void* ) );
+static void* sortPart( void *arg );
+static void* mergePart( void *arg );
+static int coRank( SortTask *task, int place );
+
+
+
+
+/* NAME: parallelSort
+ * PURPOSE: Sort an array of TVEntry structures with a comparison function,
+ *          on several threads.
+ * IMPORTS: [ TVEntry* ] array: the array to sort
+ *          [ int ] arraySize: the size of the array passed
+ *          [ int (*)( const void*, const void* ) ] compare: the comparison
+ *          function, as would be given to qsort()
+ *          [ int ] threads: the most threads to sort with
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array. threads is greater than 0.
+ *  POST: array is sorted as compare orders it OR an error is output and
+ *        array is left unchanged.
+ * REMARKS: The array is split into one part per thread, and each part is
+ *          sorted by qsort() on its own thread. The parts are then merged in
+ *          pairs until one is left, and every merge is shared out between
+ *          all the threads, by working out where each thread's share of
+ *          the output starts in both parts, so no round is left to a single
+ *          thread. Equal entries are taken from the earlier part first, but
+ *          within a part they are in whatever order qsort() left them. */
+
+int parallelSort( TVEntry *array, int arraySize,
+                    int ( *compare )( const void*, const void* ),
+                    int threads )
+{
+    int success = TRUE, parts, runs, pairs, pieces, shares, count, end;
+    int ii, jj;
+    int bounds[MAX_SORT_THREADS + 1];
+    SortTask tasks[MAX_SORT_THREADS + 1];
+    TVEntry *spare = NULL, *from = array, *to, *swap;
+
+    /* small arrays are not worth starting threads for */
+    if ( threads > MAX_SORT_THREADS )
+    {
+        threads = MAX_SORT_THREADS;
+    }
+    parts = ( threads < arraySize / MIN_SORT_PART ) ? threads :
+                                                arraySize / MIN_SORT_PART;
+    if ( parts > 1 )
+    {
+        spare = ( TVEntry* )malloc( ( size_t )arraySize *
+                                        sizeof ( TVEntry ) );
+    }
+
+    if ( parts <= 1 )
+    {
+        /* an empty input has no array at all to pass to qsort() */
+        if ( arraySize > 0 )
+        {
+            qsort( ( void* )array, arraySize, sizeof ( TVEntry ), compare );
+        }
+    }
+    else if ( spare == NULL )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        /* sort each part on its own thread */
+        for ( ii = 0; ii <= parts; ii++ )
+        {
+            bounds[ii] = splitPoint( arraySize, parts, ii );
+        }
+        for ( ii = 0; ii < parts; ii++ )
+        {
+            tasks[ii].array = array;
+            tasks[ii].start = bounds[ii];
+            tasks[ii].end = bounds[ii + 1];
+            tasks[ii].compare = compare;
+        }
+        runTasks( tasks, parts, sortPart );
+
+        /* merge pairs of runs, from one buffer to the other, until the
+         * whole array is one run */
+        to = spare;
+        for ( runs = parts; runs > 1; runs = ( runs + 1 ) / 2 )
+        {
+            pairs = runs / 2;
+            pieces = ( threads / pairs > 1 ) ? threads / pairs : 1;
+            count = 0;
+
+            for ( ii = 0; ii < runs; ii += 2 )
+            {
+                /* the last run of an odd amount has nothing to merge with,
+                 * so it is merged with an empty run, which copies it */
+                end = ( ii + 1 < runs ) ? bounds[ii + 2] : bounds[ii + 1];
+                shares = ( ii + 1 < runs ) ? pieces : 1;
+
+                for ( jj = 0; jj < shares; jj++ )
+                {
+                    tasks[count].array = from;
+                    tasks[count].merged = to;
+                    tasks[count].start = bounds[ii];
+                    tasks[count].middle = bounds[ii + 1];
+                    tasks[count].end = end;
+                    tasks[count].first = splitPoint( end - bounds[ii],
+                                                        shares, jj );
+                    tasks[count].last = splitPoint( end - bounds[ii],
+                                                        shares, jj + 1 );
+                    tasks[count].compare = compare;
+                    count++;
+                }
+            }
+            runTasks( tasks, count, mergePart );
+
+            /* every other bound is gone, as each pair is now one run */
+            for ( ii = 0; ii * 2 < runs; ii++ )
+            {
+                bounds[ii] = bounds[ii * 2];
+            }
+            bounds[( runs + 1 ) / 2] = arraySize;
+
+            swap = from;
+            from = to;
+            to = swap;
+        }
+
+        if ( from != array )
+        {
+            memcpy( array, from, ( size_t )arraySize * sizeof ( TVEntry ) );
+        }
+    }
+
+    free( spare );
+    return success;
+}
+
+
+
+
+/* NAME: splitPoint
+ * PURPOSE: Work out where one part of an evenly split range starts.
+ * IMPORTS: [ int ] size: the size of the range
+ *          [ int ] parts: the amount of parts to split it into
+ *          [ int ] part: the part to find the start of, or parts for the
+ *          end of the range
+ * EXPORTS: [ int ] point: the index the part starts at
+ * ASSERTIONS
+ *  PRE: parts is greater than 0, part is between 0 and parts.
+ *  POST: Parts differ in size by at most 1.
+ * REMARKS: Worked out without multiplying size by part, so it can not
+ *          overflow an int. */
+
+int splitPoint( int size, int parts, int part )
+{
+    return part * ( size / parts ) +
+                ( ( part < size % parts ) ? part : size % parts );
+}
+
+
+
+
+/* NAME: runTasks
+ * PURPOSE: Run every task at the same time, and wait for them all.
+ * IMPORTS: [ SortTask* ] tasks: the tasks to run
+ *          [ int ] count: the amount of tasks
+ *          [ void* (*)( void* ) ] routine: the function to run each on
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: count is between 1 and MAX_SORT_THREADS + 1.
+ *  POST: routine has finished with every task.
+ * REMARKS: Task 0 is run on this thread while the others are on threads
+ *          of their own. A task that can not get a thread is run here
+ *          instead, so the sort still finishes, just more slowly. */
+
+void runTasks( SortTask *tasks, int count, void* ( *routine )( void* ) )
+{
+    int ii;
+    pthread_t workers[MAX_SORT_THREADS + 1];
+
+    for ( ii = 1; ii < count; ii++ )
+    {
+        tasks[ii].threaded = ( pthread_create( &workers[ii], NULL, routine,
+                                                &tasks[ii] ) == 0 );
+        if ( !tasks[ii].threaded )
+        {
+            routine( &tasks[ii] );
+        }
+    }
+    routine( &tasks[0] );
+    for ( ii = 1; ii < count; ii++ )
+    {
+        if ( tasks[ii].threaded )
+        {
+            pthread_join( workers[ii], NULL );
+        }
+    }
+}
+
+
+
+
+/* NAME: sortPart
+ * PURPOSE: Sort one part of an array with qsort().
+ * IMPORTS: [ void* ] arg: the SortTask of the part to sort
+ * EXPORTS: [ void* ] result: always NULL
+ * ASSERTIONS
+ *  PRE: arg points to a SortTask with array, start, end and compare set.
+ *  POST: The part from start to end is sorted.
+ * REMARKS: Has the signature of a pthread start routine so it can be run on
+ *          a worker thread. */
+
+void* sortPart( void *arg )
+{
+    SortTask *task = ( SortTask* )arg;
+
+    qsort( ( void* )( task->array + task->start ), task->end - task->start,
+                sizeof ( TVEntry ), task->compare );
+    return NULL;
+}
+
+
+
+
+/* NAME: mergePart
+ * PURPOSE: Write one share of the merge of two sorted runs.
+ * IMPORTS: [ void* ] arg: the SortTask of the share to merge
+ * EXPORTS: [ void* ] result: always NULL
+ * ASSERTIONS
+ *  PRE: arg points to a SortTask with every field set, and both runs of
+ *       array are sorted.
+ *  POST: merged holds the entries that belong from first to last in the
+ *        merge of the runs.
+ * REMARKS: Has the signature of a pthread start routine so it can be run on
+ *          a worker thread. coRank() finds which entries of each run the
+ *          share starts and ends with, so shares never overlap. */
+
+void* mergePart( void *arg )
+{
+    SortTask *task = ( SortTask* )arg;
+    TVEntry *out = task->merged + task->start + task->first;
+    int ii, iiEnd, jj, jjEnd;
+
+    ii = task->start + coRank( task, task->first );
+    iiEnd = task->start + coRank( task, task->last );
+    jj = task->middle + task->first - ( ii - task->start );
+    jjEnd = task->middle + task->last - ( iiEnd - task->start );
+
+    /* take from the first run unless the second run's entry is smaller,
+     * which keeps equal entries in the order they were in */
+    while ( ( ii < iiEnd ) && ( jj < jjEnd ) )
+    {
+        if ( task->compare( &task->array[jj], &task->array[ii] ) < 0 )
+        {
+            *out++ = task->array[jj++];
+        }
+        else
+        {
+            *out++ = task->array[ii++];
+        }
+    }
+    while ( ii < iiEnd )
+    {
+        *out++ = task->array[ii++];
+    }
+    while ( jj < jjEnd )
+    {
+        *out++ = task->array[jj++];
+    }
+    return NULL;
+}
+
+
+
+
+/* NAME: coRank
+ * PURPOSE: Find how many entries of the first run come before some place
+ *          in the merge of two runs.
+ * IMPORTS: [ SortTask* ] task: the task holding the runs
+ *          [ int ] place: the place in the merged runs, counting from start
+ * EXPORTS: [ int ] taken: the amount of the first place entries of the
+ *          merge that come from the first run, the rest are from the second
+ * ASSERTIONS
+ *  PRE: Both runs of task are sorted. place is no more than the size of
+ *       both runs together.
+ *  POST: The merge from place onwards starts with the entries of each run
+ *        after the ones taken before place.
+ * REMARKS: A binary search, so O(log n) comparisons. Too few are taken from
+ *          the first run while its next entry would be merged before the
+ *          last one taken from the second run. */
+
+int coRank( SortTask *task, int place )
+{
+    int sizeA = task->middle - task->start, sizeB = task->end - task->middle;
+    int low, high, taken, takenB;
+    TVEntry *runA = task->array + task->start;
+    TVEntry *runB = task->array + task->middle;
+
+    low = ( place > sizeB ) ? place - sizeB : 0;
+    high = ( place < sizeA ) ? place : sizeA;
+
+    while ( low < high )
+    {
+        taken = low + ( high - low ) / 2;
+        takenB = place - taken;
+
+        if ( ( takenB > 0 ) &&
+                ( task->compare( &runA[taken], &runB[takenB - 1] ) <= 0 ) )
+        {
+            low = taken + 1;
+        }
+        else
+        {
+            high = taken;
+        }
+    }
+    return low;
+}
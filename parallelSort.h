@@ -0,0 +1,36 @@
+/* FILE: parallelSort.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, definitions, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef PARALLELSORT_H
+#define PARALLELSORT_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "boolean.h"
+
+
+/* most threads an array is sorted with, and the least amount of entries
+ * worth giving a thread of its own */
+#define MAX_SORT_THREADS 64
+#define MIN_SORT_PART 16384
+
+
+int parallelSort( TVEntry *array, int arraySize,
+                    int ( *compare )( const void*, const void* ),
+                    int threads );
+
+
+
+#endif
@@ -0,0 +1,456 @@
+/* FILE: query.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Answer queries for the entries airing in a span of the week,
+ *          such as friday 18:00 to saturday 02:00, or weekdays from 06:00
+ *          to 09:00, or the next few entries after a time, and read such
+ *          spans from strings.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: Spans are half open, an entry airing at the end of a span is
+ *           not in it, so back to back spans never share an entry.
+ */
+
+
+#include "query.h"
+
+
+static int sameWord( const char *text, int length, const char *word );
+
+
+
+
+/* NAME: buildTimeIndex
+ * PURPOSE: Put an array of entries in time order, and index it for
+ *          queries.
+ * IMPORTS: [ TimeIndex* ] index: the index to build
+ *          [ TVEntry* ] array: the entries to index
+ *          [ int ] arraySize: the size of the array passed
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: array is sorted by time and index refers to it OR an error is
+ *        output and array is left unchanged.
+ * REMARKS: Sorted by sortByTime(), so building the index is linear, and
+ *          every query after it is logarithmic. */
+
+int buildTimeIndex( TimeIndex *index, TVEntry *array, int arraySize )
+{
+    int success = sortByTime( array, arraySize );
+
+    index->entries = array;
+    index->length = arraySize;
+    return success;
+}
+
+
+
+
+/* NAME: findKey
+ * PURPOSE: Find the first entry of an index that airs at or after a
+ *          minute of the week.
+ * IMPORTS: [ const TimeIndex* ] index: the index to search
+ *          [ unsigned int ] key: the minute of the week to search for
+ * EXPORTS: [ int ] place: index of the first entry with a key of at least
+ *          key, or the length of the index if there is none
+ * ASSERTIONS
+ *  PRE: index was built by buildTimeIndex().
+ *  POST: Every entry before place airs before key.
+ * REMARKS: A binary search, so O(log n). */
+
+int findKey( const TimeIndex *index, unsigned int key )
+{
+    int low = 0, high = index->length, middle;
+
+    while ( low < high )
+    {
+        middle = low + ( high - low ) / 2;
+
+        if ( index->entries[middle].key < key )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+
+
+
+/* NAME: queryRange
+ * PURPOSE: Find every entry airing from one minute of the week up to
+ *          another.
+ * IMPORTS: [ const TimeIndex* ] index: the index to search
+ *          [ unsigned int ] from: the minute of the week the span starts
+ *          [ unsigned int ] to: the minute of the week the span ends, which
+ *          is not part of it
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: from and to are below MINUTES_PER_WEEK.
+ *  POST: The entries are added to results in the order they air, starting
+ *        from from, OR an error is output.
+ * REMARKS: A span whose end is not after its start goes through the end
+ *          of sunday and on from the start of monday, so it is two slices
+ *          of the index, and a span ending where it starts is the whole
+ *          week. Either way the entries are found by two binary searches
+ *          and copied out, O(log n) plus the entries found. */
+
+int queryRange( const TimeIndex *index, unsigned int from, unsigned int to,
+                    Vector *results )
+{
+    int success, first, last;
+
+    first = findKey( index, from );
+    last = findKey( index, to );
+
+    if ( from < to )
+    {
+        success = appendVector( results, index->entries + first,
+                                    last - first );
+    }
+    else
+    {
+        success = ( appendVector( results, index->entries + first,
+                                    index->length - first ) ) &&
+                    ( appendVector( results, index->entries, last ) );
+    }
+
+    if ( !success )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: queryWindow
+ * PURPOSE: Find every entry airing between two times of the day, on each
+ *          of a set of days.
+ * IMPORTS: [ const TimeIndex* ] index: the index to search
+ *          [ unsigned int ] days: the days to search, as given by
+ *          parseDays()
+ *          [ unsigned int ] from: the minute of the day the window starts
+ *          [ unsigned int ] to: the minute of the day the window ends,
+ *          which is not part of it
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: from and to are below MINUTES_PER_DAY.
+ *  POST: The entries are added to results, a day at a time from monday,
+ *        OR an error is output.
+ * REMARKS: A window whose end is not after its start ends on the next day,
+ *          so 22:00 to 02:00 on sunday runs into monday. Each day is one
+ *          queryRange(). */
+
+int queryWindow( const TimeIndex *index, unsigned int days,
+                    unsigned int from, unsigned int to, Vector *results )
+{
+    int success = TRUE, dayCode;
+    unsigned int start, end;
+
+    for ( dayCode = 1; ( dayCode <= DAYS_PER_WEEK ) && ( success );
+            dayCode++ )
+    {
+        if ( days & DAY_BIT( dayCode ) )
+        {
+            start = ( dayCode - 1 ) * MINUTES_PER_DAY + from;
+            end = ( dayCode - 1 ) * MINUTES_PER_DAY + to;
+            if ( to <= from )
+            {
+                end += MINUTES_PER_DAY;
+            }
+            success = queryRange( index, start, end % MINUTES_PER_WEEK,
+                                    results );
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: queryNext
+ * PURPOSE: Find the next entries to air from a minute of the week.
+ * IMPORTS: [ const TimeIndex* ] index: the index to search
+ *          [ unsigned int ] from: the minute of the week to start from
+ *          [ int ] count: the most entries to find
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: from is below MINUTES_PER_WEEK, count is not negative.
+ *  POST: The first count entries airing at or after from are added to
+ *        results in the order they air, or every entry if there are fewer,
+ *        OR an error is output.
+ * REMARKS: Past the end of sunday the entries go on from monday, so each
+ *          entry is found at most once. One binary search and a copy of
+ *          the entries found, O(log n + count). */
+
+int queryNext( const TimeIndex *index, unsigned int from, int count,
+                    Vector *results )
+{
+    int success, first, taken;
+
+    first = findKey( index, from );
+    count = ( count < index->length ) ? count : index->length;
+    taken = ( count < index->length - first ) ? count :
+                                                index->length - first;
+
+    success = ( appendVector( results, index->entries + first, taken ) ) &&
+                ( appendVector( results, index->entries, count - taken ) );
+
+    if ( !success )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: selectNext
+ * PURPOSE: Find the next entries to air from a minute of the week, in an
+ *          array that has not been indexed.
+ * IMPORTS: [ const TVEntry* ] array: the entries, in any order
+ *          [ int ] arraySize: the size of the array passed
+ *          [ unsigned int ] from: the minute of the week to start from
+ *          [ int ] count: the most entries to find
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: from is below MINUTES_PER_WEEK, count is not negative.
+ *  POST: results has the same entries added, in the same order, as
+ *        queryNext() would add from an index of array, OR an error is
+ *        output.
+ * REMARKS: A partial counting sort on how many minutes after from each
+ *          entry airs. The counts show how far ahead the last entry wanted
+ *          is, so only entries up to there are placed, straight into
+ *          results, and the array is never sorted. Two passes over the
+ *          array, O(n), which beats building an index for one query. */
+
+int selectNext( const TVEntry *array, int arraySize, unsigned int from,
+                    int count, Vector *results )
+{
+    int success = TRUE, ii;
+    unsigned int ahead, last = 0;
+    int *starts = NULL;
+    TVEntry *found;
+
+    count = ( count < arraySize ) ? count : arraySize;
+    if ( count > 0 )
+    {
+        starts = ( int* )calloc( MINUTES_PER_WEEK + 1, sizeof ( int ) );
+    }
+
+    if ( count <= 0 )
+    {
+        /* nothing to find */
+    }
+    else if ( ( starts == NULL ) ||
+            ( !reserveVector( results, results->length + count ) ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        /* count how many entries air each amount of minutes ahead */
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            starts[( array[ii].key + MINUTES_PER_WEEK - from ) %
+                        MINUTES_PER_WEEK + 1]++;
+        }
+
+        /* each amount starts after every entry airing sooner, up to the
+         * amount the last entry wanted is at */
+        for ( ahead = 1; ( ahead <= MINUTES_PER_WEEK ) &&
+                ( starts[ahead - 1] + starts[ahead] < count ); ahead++ )
+        {
+            starts[ahead] += starts[ahead - 1];
+            last = ahead;
+        }
+
+        /* equal amounts stay in array order, as in an index, and entries
+         * past the last wanted are left out */
+        found = ( TVEntry* )results->data + results->length;
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            ahead = ( array[ii].key + MINUTES_PER_WEEK - from ) %
+                        MINUTES_PER_WEEK;
+            if ( ( ahead <= last ) && ( starts[ahead] < count ) )
+            {
+                found[starts[ahead]++] = array[ii];
+            }
+        }
+        results->length += count;
+    }
+
+    free( starts );
+    return success;
+}
+
+
+
+
+/* NAME: parseClock
+ * PURPOSE: Read a time of the day, such as 6:30 or 18:00.
+ * IMPORTS: [ const char* ] text: the time, as HH:MM in 24 hour time
+ *          [ unsigned int* ] minute: where to store the minute of the day
+ * EXPORTS: [ int ] valid: validity of the time
+ *          FALSE is used for invalid, TRUE for valid
+ * ASSERTIONS
+ *  PRE: text is null-terminated.
+ *  POST: minute holds the minute of the day OR valid is FALSE.
+ * REMARKS: The hour may be one digit, the minutes must be two, the same
+ *          as times in the input file. */
+
+int parseClock( const char *text, unsigned int *minute )
+{
+    int valid, length = strlen( text ), colon, ii, hour, minutes;
+
+    colon = length - 3;
+    valid = ( ( length == 4 ) || ( length == 5 ) ) &&
+                ( text[colon] == ':' );
+
+    for ( ii = 0; ( ii < length ) && ( valid ); ii++ )
+    {
+        valid = ( ii == colon ) || ( isdigit( ( unsigned char )text[ii] ) );
+    }
+
+    if ( valid )
+    {
+        hour = atoi( text );
+        minutes = atoi( text + colon + 1 );
+        valid = ( hour < 24 ) && ( minutes < 60 );
+        *minute = hour * 60 + minutes;
+    }
+    return valid;
+}
+
+
+
+
+/* NAME: parseMoment
+ * PURPOSE: Read a time of the week, such as "friday 18:00".
+ * IMPORTS: [ const char* ] text: the day, a space, then the time of day
+ *          [ unsigned int* ] key: where to store the minute of the week
+ * EXPORTS: [ int ] valid: validity of the time
+ *          FALSE is used for invalid, TRUE for valid
+ * ASSERTIONS
+ *  PRE: text is null-terminated.
+ *  POST: key holds the minute of the week, the same as a TVEntry airing
+ *        then would have, OR valid is FALSE.
+ * REMARKS: The day can be in any case. */
+
+int parseMoment( const char *text, unsigned int *key )
+{
+    int valid = FALSE, dayCode;
+    unsigned int minute;
+    const char *space = strchr( text, ' ' );
+
+    if ( space != NULL )
+    {
+        dayCode = getDayToken( text, space - text );
+        valid = ( dayCode != 0 ) && ( parseClock( space + 1, &minute ) );
+        if ( valid )
+        {
+            *key = ( dayCode - 1 ) * MINUTES_PER_DAY + minute;
+        }
+    }
+    return valid;
+}
+
+
+
+
+/* NAME: parseDays
+ * PURPOSE: Read a set of days, such as "weekdays" or "friday-sunday".
+ * IMPORTS: [ const char* ] text: a day, two days with a '-' between them,
+ *          "weekdays", "weekend" or "everyday"
+ *          [ unsigned int* ] days: where to store the set, with DAY_BIT()
+ *          of each day code in it set
+ * EXPORTS: [ int ] valid: validity of the days
+ *          FALSE is used for invalid, TRUE for valid
+ * ASSERTIONS
+ *  PRE: text is null-terminated.
+ *  POST: days holds the set of days OR valid is FALSE.
+ * REMARKS: Two days are every day from the first to the second, going on
+ *          from sunday to monday, so "saturday-monday" is three days. */
+
+int parseDays( const char *text, unsigned int *days )
+{
+    int valid = TRUE, first, last, length = strlen( text );
+    const char *dash = strchr( text, '-' );
+
+    if ( sameWord( text, length, "weekdays" ) )
+    {
+        *days = WEEKDAYS;
+    }
+    else if ( sameWord( text, length, "weekend" ) )
+    {
+        *days = WEEKEND;
+    }
+    else if ( sameWord( text, length, "everyday" ) )
+    {
+        *days = WEEKDAYS | WEEKEND;
+    }
+    else if ( dash != NULL )
+    {
+        first = getDayToken( text, dash - text );
+        last = getDayToken( dash + 1, strlen( dash + 1 ) );
+        valid = ( first != 0 ) && ( last != 0 );
+
+        /* add each day from the first, until the last has been added */
+        *days = ( valid ) ? DAY_BIT( first ) : 0;
+        while ( ( valid ) && ( first != last ) )
+        {
+            first = ( first % DAYS_PER_WEEK ) + 1;
+            *days |= DAY_BIT( first );
+        }
+    }
+    else
+    {
+        first = getDayToken( text, length );
+        valid = ( first != 0 );
+        *days = ( valid ) ? DAY_BIT( first ) : 0;
+    }
+    return valid;
+}
+
+
+
+
+/* NAME: sameWord
+ * PURPOSE: Check whether some chars are a word, in any case.
+ * IMPORTS: [ const char* ] text: the chars to check
+ *          [ int ] length: the amount of chars in text
+ *          [ const char* ] word: the lowercase, null-terminated word
+ * EXPORTS: [ int ] same: TRUE if text is word
+ * ASSERTIONS
+ *  PRE: text points to at least length chars.
+ *  POST: N/A
+ * REMARKS: Private to this file. */
+
+int sameWord( const char *text, int length, const char *word )
+{
+    int ii = 0;
+
+    while ( ( ii < length ) && ( word[ii] != '\0' ) &&
+                ( tolower( ( unsigned char )text[ii] ) == word[ii] ) )
+    {
+        ii++;
+    }
+    return ( ii == length ) && ( word[ii] == '\0' );
+}
@@ -0,0 +1,65 @@
+/* FILE: query.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef QUERY_H
+#define QUERY_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "vector.h"
+#include "sort.h"
+#include "comparison.h"
+#include "boolean.h"
+
+
+/* bits of a day set given by parseDays(), one per day code */
+#define DAY_BIT( dayCode ) ( 1u << ( dayCode ) )
+#define WEEKDAYS ( DAY_BIT( 1 ) | DAY_BIT( 2 ) | DAY_BIT( 3 ) | \
+                    DAY_BIT( 4 ) | DAY_BIT( 5 ) )
+#define WEEKEND ( DAY_BIT( 6 ) | DAY_BIT( 7 ) )
+
+
+/* NAME: TimeIndex
+ * PURPOSE: Hold entries in time order, so the entries airing in any span
+ *          of the week can be found with binary searches.
+ * FIELDS:  [ const TVEntry* ] entries: the entries, sorted by their minute
+ *          of the week key
+ *          [ int ] length: the amount of entries
+ * REMARKS: Made by buildTimeIndex(). The entries are not copied, so the
+ *          array they are in must outlive the index. */
+
+typedef struct {
+    const TVEntry *entries;
+    int length;
+} TimeIndex;
+
+
+int buildTimeIndex( TimeIndex *index, TVEntry *array, int arraySize );
+int findKey( const TimeIndex *index, unsigned int key );
+int queryRange( const TimeIndex *index, unsigned int from, unsigned int to,
+                    Vector *results );
+int queryWindow( const TimeIndex *index, unsigned int days,
+                    unsigned int from, unsigned int to, Vector *results );
+int queryNext( const TimeIndex *index, unsigned int from, int count,
+                    Vector *results );
+int selectNext( const TVEntry *array, int arraySize, unsigned int from,
+                    int count, Vector *results );
+int parseClock( const char *text, unsigned int *minute );
+int parseMoment( const char *text, unsigned int *key );
+int parseDays( const char *text, unsigned int *days );
+
+
+
+#endif
@@ -0,0 +1,323 @@
+/* FILE: schedule.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Map the titles of a guide, ignoring case, to the times each
+ *          airs, so a show's weekly schedule can be looked up.
+ * REFERENCE: FNV-1a hash, http://www.isthe.com/chongo/tech/comp/fnv/
+ * LAST MOD: 17/10/2026
+ * COMMENTS: Open addressing with linear probing, the same as the title
+ *           pool's table, but hashing the chars folded by foldChar().
+ */
+
+
+#include "schedule.h"
+
+
+static unsigned long hashFolded( const char *title, int length );
+static int sameShow( const Schedule *schedule, unsigned int show,
+                        const char *title, int length, unsigned long hash );
+
+
+
+
+/* NAME: buildSchedule
+ * PURPOSE: Build the schedule of every show of an array of entries.
+ * IMPORTS: [ Schedule* ] schedule: the schedule to build
+ *          [ const TitlePool* ] pool: the pool the titles of array are in
+ *          [ const TVEntry* ] array: the entries to build it from
+ *          [ int ] arraySize: the size of the array passed
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: schedule holds every entry of array OR an error is output and
+ *        schedule holds nothing.
+ * REMARKS: Each distinct title of the pool is put in the table, joining
+ *          the show of a title only differing by case if there is one.
+ *          The entries are then placed by show from a copy sorted by time,
+ *          so every step is linear. */
+
+int buildSchedule( Schedule *schedule, const TitlePool *pool,
+                    const TVEntry *array, int arraySize )
+{
+    int success = TRUE, ii, length;
+    unsigned int id, slot, *shows;
+    unsigned long hash;
+    const char *title;
+    TVEntry *sorted;
+
+    schedule->pool = pool;
+    schedule->count = 0;
+    schedule->starts = NULL;
+    schedule->airings = NULL;
+
+    /* a power of 2 at least twice the titles, as there are no more shows */
+    schedule->tableSize = 1;
+    while ( schedule->tableSize < pool->count * 2 )
+    {
+        schedule->tableSize *= 2;
+    }
+
+    schedule->table = ( unsigned int* )calloc( schedule->tableSize,
+                                                sizeof ( unsigned int ) );
+    schedule->names = ( unsigned int* )malloc( ( pool->count + 1 ) *
+                                                sizeof ( unsigned int ) );
+    schedule->hashes = ( unsigned long* )malloc( ( pool->count + 1 ) *
+                                                sizeof ( unsigned long ) );
+    shows = ( unsigned int* )malloc( ( pool->count + 1 ) *
+                                        sizeof ( unsigned int ) );
+    sorted = ( TVEntry* )malloc( ( size_t )( arraySize + 1 ) *
+                                    sizeof ( TVEntry ) );
+
+    if ( ( schedule->table == NULL ) || ( schedule->names == NULL ) ||
+            ( schedule->hashes == NULL ) || ( shows == NULL ) ||
+            ( sorted == NULL ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+
+    for ( id = 0; ( id < pool->count ) && ( success ); id++ )
+    {
+        title = getTitle( pool, id );
+        length = getTitleLength( pool, id );
+        hash = hashFolded( title, length );
+
+        /* linear probing, until the show or an empty slot is found */
+        slot = ( unsigned int )( hash & ( schedule->tableSize - 1 ) );
+        while ( ( schedule->table[slot] != 0 ) &&
+                ( !sameShow( schedule, schedule->table[slot] - 1, title,
+                                length, hash ) ) )
+        {
+            slot = ( slot + 1 ) & ( schedule->tableSize - 1 );
+        }
+
+        if ( schedule->table[slot] == 0 )
+        {
+            schedule->names[schedule->count] = id;
+            schedule->hashes[schedule->count] = hash;
+            schedule->count++;
+            schedule->table[slot] = schedule->count;
+        }
+        shows[id] = schedule->table[slot] - 1;
+    }
+
+    if ( success )
+    {
+        schedule->starts = ( int* )calloc( schedule->count + 1,
+                                            sizeof ( int ) );
+        schedule->airings = ( unsigned short* )malloc(
+                    ( size_t )( arraySize + 1 ) * sizeof ( unsigned short ) );
+        if ( ( schedule->starts == NULL ) || ( schedule->airings == NULL ) )
+        {
+            fprintf( stderr, "Error: Memory not assigned!\n" );
+            success = FALSE;
+        }
+    }
+
+    if ( success )
+    {
+        /* each show's airings start after those of every show before it */
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            schedule->starts[shows[array[ii].title] + 1]++;
+        }
+        for ( id = 1; id <= schedule->count; id++ )
+        {
+            schedule->starts[id] += schedule->starts[id - 1];
+        }
+
+        if ( arraySize > 0 )
+        {
+            memcpy( sorted, array, ( size_t )arraySize * sizeof ( TVEntry ) );
+        }
+        success = sortByTime( sorted, arraySize );
+    }
+
+    if ( success )
+    {
+        /* starts[show] moves up as the show's airings are placed, so each
+         * ends up where the next show's airings start */
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            schedule->airings[schedule->starts[shows[sorted[ii].title]]++] =
+                sorted[ii].key;
+        }
+        for ( id = schedule->count; id > 0; id-- )
+        {
+            schedule->starts[id] = schedule->starts[id - 1];
+        }
+        schedule->starts[0] = 0;
+    }
+    else
+    {
+        freeSchedule( schedule );
+    }
+
+    free( shows );
+    free( sorted );
+    return success;
+}
+
+
+
+
+/* NAME: findShow
+ * PURPOSE: Find the show with some title, ignoring case.
+ * IMPORTS: [ const Schedule* ] schedule: the schedule to look in
+ *          [ const char* ] title: the first char of the title
+ *          [ int ] length: the amount of chars in the title
+ * EXPORTS: [ int ] show: the show with the title, or -1 if none has it
+ * ASSERTIONS
+ *  PRE: schedule was built by buildSchedule().
+ *  POST: N/A
+ * REMARKS: O(1) expected, as the table is at most half full. */
+
+int findShow( const Schedule *schedule, const char *title, int length )
+{
+    int show = -1;
+    unsigned long hash = hashFolded( title, length );
+    unsigned int slot;
+
+    slot = ( unsigned int )( hash & ( schedule->tableSize - 1 ) );
+    while ( ( schedule->table[slot] != 0 ) && ( show == -1 ) )
+    {
+        if ( sameShow( schedule, schedule->table[slot] - 1, title, length,
+                        hash ) )
+        {
+            show = schedule->table[slot] - 1;
+        }
+        slot = ( slot + 1 ) & ( schedule->tableSize - 1 );
+    }
+    return show;
+}
+
+
+
+
+/* NAME: querySchedule
+ * PURPOSE: Find every airing of a show in the week.
+ * IMPORTS: [ const Schedule* ] schedule: the schedule to look in
+ *          [ const char* ] title: the title of the show, in any case
+ *          [ Vector* ] results: vector of TVEntry to add the airings to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: schedule was built by buildSchedule(). title is null-terminated.
+ *  POST: The airings are added to results in time order, OR an error is
+ *        output. Nothing is added if no show has the title.
+ * REMARKS: Every airing is given the show's first title read, so titles
+ *          only differing by case are output the same. */
+
+int querySchedule( const Schedule *schedule, const char *title,
+                    Vector *results )
+{
+    int success = TRUE, show, ii;
+    TVEntry airing;
+
+    show = findShow( schedule, title, strlen( title ) );
+
+    /* the padding of airing is copied with it, so it is cleared first */
+    memset( &airing, 0, sizeof ( TVEntry ) );
+    if ( show != -1 )
+    {
+        airing.title = schedule->names[show];
+        for ( ii = schedule->starts[show];
+                ( ii < schedule->starts[show + 1] ) && ( success ); ii++ )
+        {
+            airing.key = schedule->airings[ii];
+            airing.day = ( unsigned char )( airing.key / MINUTES_PER_DAY +
+                                            1 );
+            success = pushVector( results, &airing );
+        }
+    }
+
+    if ( !success )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: freeSchedule
+ * PURPOSE: Release everything held by a schedule.
+ * IMPORTS: [ Schedule* ] schedule: the schedule to release
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: schedule was given to buildSchedule().
+ *  POST: schedule holds nothing.
+ * REMARKS: Safe to call on a schedule that has already been freed. The pool
+ *          is not freed, as the schedule does not own it. */
+
+void freeSchedule( Schedule *schedule )
+{
+    free( schedule->table );
+    free( schedule->names );
+    free( schedule->hashes );
+    free( schedule->starts );
+    free( schedule->airings );
+    schedule->table = NULL;
+    schedule->names = NULL;
+    schedule->hashes = NULL;
+    schedule->starts = NULL;
+    schedule->airings = NULL;
+    schedule->count = 0;
+}
+
+
+
+
+/* NAME: hashFolded
+ * PURPOSE: Hash the chars of a title, ignoring case.
+ * IMPORTS: [ const char* ] title: the first char of the title
+ *          [ int ] length: the amount of chars in the title
+ * EXPORTS: [ unsigned long ] hash: 32 bit FNV-1a hash of the chars folded
+ *          by foldChar()
+ * ASSERTIONS
+ *  PRE: title points to at least length chars.
+ *  POST: Titles only differing by case have the same hash.
+ * REMARKS: Private to this file. */
+
+unsigned long hashFolded( const char *title, int length )
+{
+    unsigned long hash = 2166136261UL;
+    int ii;
+
+    for ( ii = 0; ii < length; ii++ )
+    {
+        hash ^= ( unsigned long )foldChar( title[ii] );
+        hash = ( hash * 16777619UL ) & 0xffffffffUL;
+    }
+    return hash;
+}
+
+
+
+
+/* NAME: sameShow
+ * PURPOSE: Check if a title is the title of a show, ignoring case.
+ * IMPORTS: [ const Schedule* ] schedule: the schedule the show is in
+ *          [ unsigned int ] show: the show to check
+ *          [ const char* ] title: the first char of the title
+ *          [ int ] length: the amount of chars in the title
+ *          [ unsigned long ] hash: the title's hash from hashFolded()
+ * EXPORTS: [ int ] same: TRUE if the show has the title, else FALSE
+ * ASSERTIONS
+ *  PRE: show is below schedule->count.
+ *  POST: N/A
+ * REMARKS: Private to this file. The hashes are compared first, so most
+ *          other shows are ruled out without comparing chars. */
+
+int sameShow( const Schedule *schedule, unsigned int show,
+                const char *title, int length, unsigned long hash )
+{
+    unsigned int id = schedule->names[show];
+
+    return ( schedule->hashes[show] == hash ) &&
+            ( getTitleLength( schedule->pool, id ) == length ) &&
+            ( comparePrefix( getTitle( schedule->pool, id ), title,
+                                length ) == 0 );
+}
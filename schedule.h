@@ -0,0 +1,70 @@
+/* FILE: schedule.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "vector.h"
+#include "sort.h"
+#include "comparison.h"
+#include "titlePool.h"
+#include "boolean.h"
+
+
+/* NAME: Schedule
+ * PURPOSE: Map each title, ignoring case, to every time it airs in the
+ *          week, so a show's schedule is found without a scan.
+ * FIELDS:  [ const TitlePool* ] pool: the pool the titles are interned in
+ *          [ unsigned int* ] table: hash table of show + 1, 0 being empty
+ *          [ unsigned int ] tableSize: the amount of slots in table, always
+ *          a power of 2
+ *          [ unsigned int* ] names: array indexed by show of the ID of the
+ *          show's first title read
+ *          [ unsigned long* ] hashes: array indexed by show of the hash of
+ *          its title, folded by foldChar()
+ *          [ unsigned int ] count: the amount of shows, which is the amount
+ *          of titles that differ once case is ignored
+ *          [ int* ] starts: array indexed by show of where its airings
+ *          start, with starts[count] the amount of airings
+ *          [ unsigned short* ] airings: the minute of the week key of every
+ *          airing, grouped by show, and in time order within each show
+ * REMARKS: Made by buildSchedule() and released by freeSchedule(). A key
+ *          holds both the day and the time, so each airing takes 2 bytes.
+ *          The table is at most half full, so probes stay short. */
+
+typedef struct {
+    const TitlePool *pool;
+    unsigned int *table;
+    unsigned int tableSize;
+    unsigned int *names;
+    unsigned long *hashes;
+    unsigned int count;
+    int *starts;
+    unsigned short *airings;
+} Schedule;
+
+
+int buildSchedule( Schedule *schedule, const TitlePool *pool,
+                    const TVEntry *array, int arraySize );
+int findShow( const Schedule *schedule, const char *title, int length );
+int querySchedule( const Schedule *schedule, const char *title,
+                    Vector *results );
+void freeSchedule( Schedule *schedule );
+
+
+
+#endif
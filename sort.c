@@ -0,0 +1,156 @@
+/* FILE: sort.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Provide sorts of TVEntry arrays that are specific to the entries'
+ *          keys or title ranks, as alternatives to qsort() with a
+ *          comparison function.
+ * REFERENCE: Counting sort, Cormen et al., Introduction to Algorithms,
+ *            3rd ed., section 8.2
+ * LAST MOD: 17/10/2026
+ * COMMENTS: None
+ */
+
+
+#include "sort.h"
+
+
+
+
+/* NAME: sortByTime
+ * PURPOSE: Sort an array of TVEntry structures by time, in linear time.
+ * IMPORTS: [ TVEntry* ] array: the array to sort
+ *          [ int ] arraySize: the size of the array passed
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: array is in time order, as compareByTime() orders it, OR an error
+ *        is output and array is left unchanged.
+ * REMARKS: A counting sort on the minute of the week key. Only 10080 keys
+ *          are possible, so counting how many entries have each key gives
+ *          where each entry goes in 2 passes over the array, rather than
+ *          O(n log n) comparisons. Entries with the same key stay in the
+ *          order they were read in. */
+
+int sortByTime( TVEntry *array, int arraySize )
+{
+    int success = TRUE, ii;
+    int *starts = NULL;
+    TVEntry *sorted = NULL;
+
+    /* starts[key] becomes the index the next entry with that key goes to.
+     * An array with less than 2 entries is already sorted */
+    if ( arraySize > 1 )
+    {
+        starts = ( int* )calloc( MINUTES_PER_WEEK + 1, sizeof ( int ) );
+        sorted = ( TVEntry* )malloc( ( size_t )arraySize *
+                                        sizeof ( TVEntry ) );
+    }
+
+    if ( arraySize < 2 )
+    {
+        /* nothing to sort */
+    }
+    else if ( ( starts == NULL ) || ( sorted == NULL ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        /* count each key, offset by one so the sums below give starts */
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            starts[array[ii].key + 1]++;
+        }
+
+        /* each key starts after every entry with a smaller key */
+        for ( ii = 1; ii <= MINUTES_PER_WEEK; ii++ )
+        {
+            starts[ii] += starts[ii - 1];
+        }
+
+        /* going forwards through the array keeps equal keys in order */
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            sorted[starts[array[ii].key]++] = array[ii];
+        }
+
+        memcpy( array, sorted, ( size_t )arraySize * sizeof ( TVEntry ) );
+    }
+
+    free( starts );
+    free( sorted );
+    return success;
+}
+
+
+
+
+/* NAME: sortByRank
+ * PURPOSE: Sort an array of TVEntry structures by the rank of their titles,
+ *          in linear time.
+ * IMPORTS: [ TVEntry* ] array: the array to sort
+ *          [ int ] arraySize: the size of the array passed
+ *          [ const unsigned int* ] rank: array indexed by title ID of the
+ *          title's place in name order, as given by rankTitles()
+ *          [ unsigned int ] rankCount: more than the largest rank
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array. rank holds every title ID in
+ *       array, each below rankCount.
+ *  POST: array is in name order, as compareByName() orders it, OR an error
+ *        is output and array is left unchanged.
+ * REMARKS: The same counting sort as sortByTime(), with the title's rank as
+ *          the key. There are never more ranks than distinct titles, so
+ *          the counts stay small however many entries there are. */
+
+int sortByRank( TVEntry *array, int arraySize, const unsigned int *rank,
+                    unsigned int rankCount )
+{
+    int success = TRUE, ii;
+    unsigned int jj;
+    int *starts = NULL;
+    TVEntry *sorted = NULL;
+
+    if ( arraySize > 1 )
+    {
+        starts = ( int* )calloc( rankCount + 1, sizeof ( int ) );
+        sorted = ( TVEntry* )malloc( ( size_t )arraySize *
+                                        sizeof ( TVEntry ) );
+    }
+
+    if ( arraySize < 2 )
+    {
+        /* nothing to sort */
+    }
+    else if ( ( starts == NULL ) || ( sorted == NULL ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            starts[rank[array[ii].title] + 1]++;
+        }
+
+        for ( jj = 1; jj <= rankCount; jj++ )
+        {
+            starts[jj] += starts[jj - 1];
+        }
+
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            sorted[starts[rank[array[ii].title]]++] = array[ii];
+        }
+
+        memcpy( array, sorted, ( size_t )arraySize * sizeof ( TVEntry ) );
+    }
+
+    free( starts );
+    free( sorted );
+    return success;
+}
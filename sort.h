@@ -0,0 +1,34 @@
+/* FILE: sort.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, definitions, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef SORT_H
+#define SORT_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "boolean.h"
+
+
+/* the amount of different keys a TVEntry can have, one per minute */
+#define MINUTES_PER_WEEK ( 7 * MINUTES_PER_DAY )
+
+
+int sortByTime( TVEntry *array, int arraySize );
+int sortByRank( TVEntry *array, int arraySize, const unsigned int *rank,
+                    unsigned int rankCount );
+
+
+
+#endif
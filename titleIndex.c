@@ -0,0 +1,244 @@
+/* FILE: titleIndex.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Index the distinct titles of a guide in name order, each with
+ *          the entries it airs at, and browse them by prefix or range.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: Titles are compared ignoring case, the same as compareByName()
+ *           compares them, so browsing gives the same order as sorting.
+ */
+
+
+#include "titleIndex.h"
+
+
+
+
+/* NAME: buildTitleIndex
+ * PURPOSE: Build the title index of an array of entries.
+ * IMPORTS: [ TitleIndex* ] index: the index to build
+ *          [ TitlePool* ] pool: the pool the titles of array are in
+ *          [ const TVEntry* ] array: the entries to index
+ *          [ int ] arraySize: the size of the array passed
+ *          [ int ] engine: RANK_QSORT or RANK_RADIX, the engine to rank
+ *          the titles with
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: index holds every entry of array OR an error is output and index
+ *        holds nothing.
+ * REMARKS: The titles are ranked, then a copy of the entries is counting
+ *          sorted by time and then by rank, which keeps the time order
+ *          within each rank. Every step but ranking is linear. */
+
+int buildTitleIndex( TitleIndex *index, TitlePool *pool,
+                        const TVEntry *array, int arraySize, int engine )
+{
+    int success, ii;
+    unsigned int id;
+
+    index->pool = pool;
+    index->names = NULL;
+    index->count = 0;
+    index->starts = NULL;
+    index->postings = NULL;
+
+    success = rankTitles( pool, engine );
+
+    if ( success )
+    {
+        /* ranks go up from 0 with no gaps, so the largest gives the count */
+        for ( id = 0; id < pool->count; id++ )
+        {
+            if ( pool->rank[id] >= index->count )
+            {
+                index->count = pool->rank[id] + 1;
+            }
+        }
+
+        index->names = ( unsigned int* )malloc( ( index->count + 1 ) *
+                                                sizeof ( unsigned int ) );
+        index->starts = ( int* )calloc( index->count + 1, sizeof ( int ) );
+        index->postings = ( TVEntry* )malloc( ( size_t )( arraySize + 1 ) *
+                                                sizeof ( TVEntry ) );
+        if ( ( index->names == NULL ) || ( index->starts == NULL ) ||
+                ( index->postings == NULL ) )
+        {
+            fprintf( stderr, "Error: Memory not assigned!\n" );
+            success = FALSE;
+        }
+    }
+
+    if ( success )
+    {
+        /* IDs are given out in the order titles are first seen, so going
+         * backwards leaves each rank named by its first title */
+        for ( id = pool->count; id > 0; id-- )
+        {
+            index->names[pool->rank[id - 1]] = id - 1;
+        }
+
+        if ( arraySize > 0 )
+        {
+            memcpy( index->postings, array,
+                        ( size_t )arraySize * sizeof ( TVEntry ) );
+        }
+        success = ( sortByTime( index->postings, arraySize ) ) &&
+                    ( sortByRank( index->postings, arraySize, pool->rank,
+                                    index->count ) );
+    }
+
+    if ( success )
+    {
+        /* each rank's postings start after those of every smaller rank */
+        for ( ii = 0; ii < arraySize; ii++ )
+        {
+            index->starts[pool->rank[index->postings[ii].title] + 1]++;
+        }
+        for ( id = 1; id <= index->count; id++ )
+        {
+            index->starts[id] += index->starts[id - 1];
+        }
+    }
+    else
+    {
+        freeTitleIndex( index );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: findTitle
+ * PURPOSE: Find where titles starting with a prefix are in name order.
+ * IMPORTS: [ const TitleIndex* ] index: the index to search
+ *          [ const char* ] prefix: the start of the titles to find, in any
+ *          case
+ *          [ int ] after: FALSE to find the first title starting with the
+ *          prefix, TRUE to find the first title after all of them
+ * EXPORTS: [ int ] rank: the rank found, or index->count if every title
+ *          comes before it
+ * ASSERTIONS
+ *  PRE: index was built by buildTitleIndex(). prefix is null-terminated.
+ *  POST: The titles starting with prefix have ranks from the rank found
+ *        with after FALSE, up to the one found with after TRUE.
+ * REMARKS: A binary search over the distinct titles, so O(log n). */
+
+int findTitle( const TitleIndex *index, const char *prefix, int after )
+{
+    int low = 0, high = index->count, middle, sortVal;
+    int length = strlen( prefix );
+
+    while ( low < high )
+    {
+        middle = low + ( high - low ) / 2;
+        sortVal = comparePrefix( getTitle( index->pool,
+                                    index->names[middle] ), prefix, length );
+
+        if ( ( sortVal < 0 ) || ( ( after ) && ( sortVal == 0 ) ) )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+
+
+
+/* NAME: queryTitles
+ * PURPOSE: Find the airings of every title from one prefix to another in
+ *          name order, such as from "a" to "c".
+ * IMPORTS: [ const TitleIndex* ] index: the index to search
+ *          [ const char* ] from: the prefix of the first titles to find
+ *          [ const char* ] to: the prefix of the last titles to find
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: index was built by buildTitleIndex(). from and to are
+ *       null-terminated.
+ *  POST: The entries are added to results in name order, and time order
+ *        within a title, OR an error is output.
+ * REMARKS: Titles starting with either prefix are included, so "a" to "c"
+ *          includes "Cars". Posting lists of ranks next to each other are
+ *          next to each other too, so the entries are one slice of the
+ *          postings, found by two binary searches, O(log n + matches). */
+
+int queryTitles( const TitleIndex *index, const char *from, const char *to,
+                    Vector *results )
+{
+    int success = TRUE, first, last;
+
+    first = findTitle( index, from, FALSE );
+    last = findTitle( index, to, TRUE );
+
+    if ( last > first )
+    {
+        success = appendVector( results,
+                    index->postings + index->starts[first],
+                    index->starts[last] - index->starts[first] );
+    }
+
+    if ( !success )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: queryPrefix
+ * PURPOSE: Find the airings of every title starting with a prefix, such as
+ *          "star".
+ * IMPORTS: [ const TitleIndex* ] index: the index to search
+ *          [ const char* ] prefix: the start of the titles to find, in any
+ *          case
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: index was built by buildTitleIndex(). prefix is null-terminated.
+ *  POST: The entries are added to results in name order, and time order
+ *        within a title, OR an error is output.
+ * REMARKS: A range from the prefix to itself. An empty prefix finds every
+ *          entry. */
+
+int queryPrefix( const TitleIndex *index, const char *prefix,
+                    Vector *results )
+{
+    return queryTitles( index, prefix, prefix, results );
+}
+
+
+
+
+/* NAME: freeTitleIndex
+ * PURPOSE: Release everything held by a title index.
+ * IMPORTS: [ TitleIndex* ] index: the index to release
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: index was given to buildTitleIndex().
+ *  POST: index holds nothing.
+ * REMARKS: Safe to call on an index that has already been freed. The pool
+ *          is not freed, as the index does not own it. */
+
+void freeTitleIndex( TitleIndex *index )
+{
+    free( index->names );
+    free( index->starts );
+    free( index->postings );
+    index->names = NULL;
+    index->starts = NULL;
+    index->postings = NULL;
+    index->count = 0;
+}
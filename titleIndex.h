@@ -0,0 +1,66 @@
+/* FILE: titleIndex.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef TITLEINDEX_H
+#define TITLEINDEX_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "vector.h"
+#include "sort.h"
+#include "comparison.h"
+#include "titlePool.h"
+#include "boolean.h"
+
+
+/* NAME: TitleIndex
+ * PURPOSE: Hold the distinct titles of a guide in name order, each with a
+ *          posting list of its airings, so titles can be browsed by prefix
+ *          or range without sorting every entry.
+ * FIELDS:  [ const TitlePool* ] pool: the pool the titles are interned in
+ *          [ unsigned int* ] names: array indexed by rank of the ID of a
+ *          title with that rank
+ *          [ unsigned int ] count: the amount of ranks, which is the amount
+ *          of titles that differ once case is ignored
+ *          [ int* ] starts: array indexed by rank of where the rank's
+ *          posting list starts, with starts[count] the amount of postings
+ *          [ TVEntry* ] postings: every entry, in name order, and in time
+ *          order within each rank
+ * REMARKS: Made by buildTitleIndex() and released by freeTitleIndex(). The
+ *          postings are a copy, so the entries indexed can change after.
+ *          Titles only differing by case share a rank, so share a posting
+ *          list. */
+
+typedef struct {
+    const TitlePool *pool;
+    unsigned int *names;
+    unsigned int count;
+    int *starts;
+    TVEntry *postings;
+} TitleIndex;
+
+
+int buildTitleIndex( TitleIndex *index, TitlePool *pool,
+                        const TVEntry *array, int arraySize, int engine );
+int findTitle( const TitleIndex *index, const char *prefix, int after );
+int queryTitles( const TitleIndex *index, const char *from, const char *to,
+                    Vector *results );
+int queryPrefix( const TitleIndex *index, const char *prefix,
+                    Vector *results );
+void freeTitleIndex( TitleIndex *index );
+
+
+
+#endif
@@ -0,0 +1,696 @@
+/* FILE: titlePool.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Intern the titles of TV guide entries, so each distinct title is
+ *          stored once, and entries can refer to it by an ID.
+ * REFERENCE: FNV-1a hash, http://www.isthe.com/chongo/tech/comp/fnv/
+ * LAST MOD: 17/10/2026
+ * COMMENTS: A guide repeats a small set of titles many times over, so the
+ *           pool stays small no matter how many entries are read.
+ */
+
+
+#include "titlePool.h"
+#include "comparison.h"
+
+
+#define POOL_TEXT_START 4096
+#define POOL_TITLES_START 64
+#define POOL_TABLE_START 128
+
+/* words of folded chars kept as a sort key, 16 chars with a 64 bit long */
+#define TITLE_KEY_WORDS 2
+#define TITLE_KEY_CHARS ( TITLE_KEY_WORDS * ( int )sizeof ( unsigned long ) )
+
+/* buckets smaller than this are insertion sorted by the radix sort */
+#define RADIX_CUTOFF 16
+
+/* chars deep the radix sort goes before handing a bucket to qsort(), so
+ * titles with very long shared prefixes can not overflow the stack */
+#define RADIX_MAX_DEPTH 64
+
+
+/* NAME: RankedTitle
+ * PURPOSE: Pair a title with its ID while the titles are sorted by name.
+ * FIELDS:  [ unsigned long [] ] key: the first TITLE_KEY_CHARS chars of the
+ *          title folded by foldChar(), packed first char highest, so that
+ *          comparing keys compares those chars as compareTitles() would
+ *          [ const char* ] title: the title, ended by a newline
+ *          [ int ] length: the amount of chars in the title
+ *          [ unsigned int ] id: the title's ID in the pool
+ * REMARKS: Private to this file, used by rankTitles(). */
+
+typedef struct {
+    unsigned long key[TITLE_KEY_WORDS];
+    const char *title;
+    int length;
+    unsigned int id;
+} RankedTitle;
+
+
+static unsigned long hashTitle( const char *title, int length );
+static int growTable( TitlePool *pool );
+static void makeTitleKey( RankedTitle *ranked );
+static int compareRanked( const void *obj1, const void *obj2 );
+static int rankedChar( const RankedTitle *ranked, int depth );
+static void radixSortRanked( RankedTitle *ranked, RankedTitle *spare,
+                                unsigned int count, int depth );
+static void insertionSortRanked( RankedTitle *ranked, unsigned int count,
+                                    int depth );
+static int compareFromDepth( const RankedTitle *item1,
+                                const RankedTitle *item2, int depth );
+
+
+
+
+/* NAME: initTitlePool
+ * PURPOSE: Set up a pool that holds no titles.
+ * IMPORTS: [ TitlePool* ] pool: the pool to set up
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: pool is empty, and nothing has been allocated for it yet.
+ * REMARKS: Memory is only allocated once the first title is interned. */
+
+void initTitlePool( TitlePool *pool )
+{
+    pool->text = NULL;
+    pool->size = 0;
+    pool->capacity = 0;
+    pool->titles = NULL;
+    pool->count = 0;
+    pool->titleCapacity = 0;
+    pool->table = NULL;
+    pool->tableSize = 0;
+    pool->rank = NULL;
+    pool->grows = 0;
+}
+
+
+
+
+/* NAME: internTitle
+ * PURPOSE: Find the ID of a title, adding the title to the pool if it has
+ *          not been seen before.
+ * IMPORTS: [ TitlePool* ] pool: the pool to look in and add to
+ *          [ const char* ] title: the first char of the title
+ *          [ int ] length: the amount of chars in the title, not counting
+ *          any newline or null-terminator after it
+ *          [ unsigned int* ] id: where to store the title's ID
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: pool was set up with initTitlePool(). length is greater than 0.
+ *  POST: *id is the ID of a title with exactly the same chars, OR FALSE is
+ *        returned as memory could not be assigned.
+ * REMARKS: Titles are compared exactly, so titles differing only by case
+ *          get different IDs and are output as they were read. Any ranks
+ *          from rankTitles() are dropped when a new title is added.
+ *          Nothing is output, so that worker threads can intern titles, and
+ *          the caller outputs the error instead. */
+
+int internTitle( TitlePool *pool, const char *title, int length,
+                    unsigned int *id )
+{
+    int success = TRUE, found = FALSE;
+    unsigned long hash = hashTitle( title, length );
+    unsigned int slot = 0;
+    PooledTitle *entry;
+
+    /* linear probing, until the title or an empty slot is found */
+    if ( pool->table != NULL )
+    {
+        slot = ( unsigned int )( hash & ( pool->tableSize - 1 ) );
+        while ( ( pool->table[slot] != 0 ) && ( !found ) )
+        {
+            entry = &pool->titles[pool->table[slot] - 1];
+            if ( ( entry->hash == hash ) && ( entry->length == length ) &&
+                    ( memcmp( pool->text + entry->offset, title,
+                                ( size_t )length ) == 0 ) )
+            {
+                *id = pool->table[slot] - 1;
+                found = TRUE;
+            }
+            else
+            {
+                slot = ( slot + 1 ) & ( pool->tableSize - 1 );
+            }
+        }
+    }
+
+    if ( !found )
+    {
+        /* keep the table at most half full so that probes stay short */
+        if ( ( pool->count + 1 ) * 2 > pool->tableSize )
+        {
+            success = growTable( pool );
+            if ( success )
+            {
+                slot = ( unsigned int )( hash & ( pool->tableSize - 1 ) );
+                while ( pool->table[slot] != 0 )
+                {
+                    slot = ( slot + 1 ) & ( pool->tableSize - 1 );
+                }
+            }
+        }
+
+        /* room for the title and its newline */
+        if ( ( success ) &&
+                ( pool->size + length + 1 > pool->capacity ) )
+        {
+            unsigned long capacity = ( pool->capacity == 0 ) ?
+                                    POOL_TEXT_START : pool->capacity * 2;
+            char *grown;
+            while ( capacity < pool->size + length + 1 )
+            {
+                capacity *= 2;
+            }
+
+            grown = ( char* )realloc( pool->text, capacity );
+            if ( grown == NULL )
+            {
+                success = FALSE;
+            }
+            else
+            {
+                pool->text = grown;
+                pool->capacity = capacity;
+                pool->grows++;
+            }
+        }
+
+        /* and room for the title's details */
+        if ( ( success ) && ( pool->count == pool->titleCapacity ) )
+        {
+            unsigned int capacity = ( pool->titleCapacity == 0 ) ?
+                                    POOL_TITLES_START : pool->titleCapacity * 2;
+            PooledTitle *grown = ( PooledTitle* )realloc( pool->titles,
+                                    capacity * sizeof ( PooledTitle ) );
+            if ( grown == NULL )
+            {
+                success = FALSE;
+            }
+            else
+            {
+                pool->titles = grown;
+                pool->titleCapacity = capacity;
+                pool->grows++;
+            }
+        }
+
+        if ( success )
+        {
+            entry = &pool->titles[pool->count];
+            entry->offset = pool->size;
+            entry->hash = hash;
+            entry->length = length;
+
+            memcpy( pool->text + pool->size, title, ( size_t )length );
+            pool->text[pool->size + length] = '\n';
+            pool->size += length + 1;
+
+            *id = pool->count;
+            pool->table[slot] = pool->count + 1;
+            pool->count++;
+
+            /* ranks only cover the titles there were when ranked */
+            free( pool->rank );
+            pool->rank = NULL;
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: getTitle
+ * PURPOSE: Get the chars of the title with some ID.
+ * IMPORTS: [ const TitlePool* ] pool: the pool the title is in
+ *          [ unsigned int ] id: the title's ID
+ * EXPORTS: [ const char* ] title: the first char of the title, which is
+ *          ended by a newline
+ * ASSERTIONS
+ *  PRE: id was given by internTitle() for this pool.
+ *  POST: N/A
+ * REMARKS: The pointer is only valid until the next title is interned, as
+ *          the text may be moved when it grows. */
+
+const char* getTitle( const TitlePool *pool, unsigned int id )
+{
+    return pool->text + pool->titles[id].offset;
+}
+
+
+
+
+/* NAME: getTitleLength
+ * PURPOSE: Get the amount of chars in the title with some ID.
+ * IMPORTS: [ const TitlePool* ] pool: the pool the title is in
+ *          [ unsigned int ] id: the title's ID
+ * EXPORTS: [ int ] length: the amount of chars, not counting the newline
+ * ASSERTIONS
+ *  PRE: id was given by internTitle() for this pool.
+ *  POST: N/A
+ * REMARKS: None */
+
+int getTitleLength( const TitlePool *pool, unsigned int id )
+{
+    return pool->titles[id].length;
+}
+
+
+
+
+/* NAME: rankTitles
+ * PURPOSE: Work out the place of every distinct title in name order, so
+ *          entries can be sorted by name by comparing ranks.
+ * IMPORTS: [ TitlePool* ] pool: the pool to rank
+ *          [ int ] engine: RANK_QSORT to sort the titles with qsort(), or
+ *          RANK_RADIX to sort them with an MSD radix sort
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: pool was set up with initTitlePool().
+ *  POST: pool->rank holds a rank for every ID OR an error is output.
+ * REMARKS: Titles that compareTitles() finds equal, such as ones only
+ *          differing by case, get the same rank, so a stable sort by rank
+ *          orders entries exactly as a stable sort by compareByName() on
+ *          their titles would. Each distinct title is compared O(log n)
+ *          times, rather than each entry, and each is case folded once
+ *          into a key, so most comparisons never look at the chars. Both
+ *          engines give the same ranks. */
+
+int rankTitles( TitlePool *pool, int engine )
+{
+    int success = TRUE;
+    unsigned int ii, rank = 0;
+    RankedTitle *ranked, *spare = NULL;
+
+    free( pool->rank );
+    pool->rank = ( unsigned int* )malloc( ( pool->count + 1 ) *
+                                            sizeof ( unsigned int ) );
+    ranked = ( RankedTitle* )malloc( ( pool->count + 1 ) *
+                                        sizeof ( RankedTitle ) );
+    if ( engine == RANK_RADIX )
+    {
+        spare = ( RankedTitle* )malloc( ( pool->count + 1 ) *
+                                        sizeof ( RankedTitle ) );
+    }
+
+    if ( ( pool->rank == NULL ) || ( ranked == NULL ) ||
+            ( ( engine == RANK_RADIX ) && ( spare == NULL ) ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        free( pool->rank );
+        pool->rank = NULL;
+        success = FALSE;
+    }
+    else
+    {
+        for ( ii = 0; ii < pool->count; ii++ )
+        {
+            ranked[ii].title = getTitle( pool, ii );
+            ranked[ii].length = getTitleLength( pool, ii );
+            ranked[ii].id = ii;
+            makeTitleKey( &ranked[ii] );
+        }
+
+        if ( engine == RANK_RADIX )
+        {
+            radixSortRanked( ranked, spare, pool->count, 0 );
+        }
+        else
+        {
+            qsort( ( void* )ranked, pool->count, sizeof ( RankedTitle ),
+                        &compareRanked );
+        }
+
+        /* the rank only goes up when a title differs from the one before */
+        for ( ii = 0; ii < pool->count; ii++ )
+        {
+            if ( ( ii > 0 ) &&
+                    ( compareRanked( &ranked[ii - 1], &ranked[ii] ) != 0 ) )
+            {
+                rank++;
+            }
+            pool->rank[ranked[ii].id] = rank;
+        }
+    }
+
+    free( ranked );
+    free( spare );
+    return success;
+}
+
+
+
+
+/* NAME: freeTitlePool
+ * PURPOSE: Release everything held by a pool.
+ * IMPORTS: [ TitlePool* ] pool: the pool to release
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: pool was set up with initTitlePool().
+ *  POST: pool is empty, the same as after initTitlePool().
+ * REMARKS: Safe to call on a pool that has already been freed. */
+
+void freeTitlePool( TitlePool *pool )
+{
+    free( pool->text );
+    free( pool->titles );
+    free( pool->table );
+    free( pool->rank );
+    initTitlePool( pool );
+}
+
+
+
+
+/* NAME: hashTitle
+ * PURPOSE: Hash the chars of a title.
+ * IMPORTS: [ const char* ] title: the first char of the title
+ *          [ int ] length: the amount of chars in the title
+ * EXPORTS: [ unsigned long ] hash: the FNV-1a hash of the chars
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: Titles with the same chars have the same hash.
+ * REMARKS: Only the low 32 bits are worked out, which is all the table
+ *          will ever use, so the result is the same whatever size long is */
+
+unsigned long hashTitle( const char *title, int length )
+{
+    unsigned long hash = 2166136261UL;
+    int ii;
+
+    for ( ii = 0; ii < length; ii++ )
+    {
+        hash ^= ( unsigned char )title[ii];
+        hash = ( hash * 16777619UL ) & 0xffffffffUL;
+    }
+    return hash;
+}
+
+
+
+
+/* NAME: growTable
+ * PURPOSE: Double the size of a pool's hash table, and place every title
+ *          into the new table.
+ * IMPORTS: [ TitlePool* ] pool: the pool whose table to grow
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: The table has room for more titles, OR pool is left unchanged.
+ * REMARKS: Helper function to internTitle(). */
+
+int growTable( TitlePool *pool )
+{
+    int success = TRUE;
+    unsigned int size, slot, ii;
+    unsigned int *table;
+
+    size = ( pool->tableSize == 0 ) ? POOL_TABLE_START : pool->tableSize * 2;
+    table = ( unsigned int* )calloc( size, sizeof ( unsigned int ) );
+
+    if ( table == NULL )
+    {
+        success = FALSE;
+    }
+    else
+    {
+        for ( ii = 0; ii < pool->count; ii++ )
+        {
+            slot = ( unsigned int )( pool->titles[ii].hash & ( size - 1 ) );
+            while ( table[slot] != 0 )
+            {
+                slot = ( slot + 1 ) & ( size - 1 );
+            }
+            table[slot] = ii + 1;
+        }
+
+        free( pool->table );
+        pool->table = table;
+        pool->tableSize = size;
+        pool->grows++;
+    }
+    return success;
+}
+
+
+
+
+/* NAME: makeTitleKey
+ * PURPOSE: Case fold the start of a title into its sort key.
+ * IMPORTS: [ RankedTitle* ] ranked: the title to make the key of
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: ranked->title and ranked->length are set.
+ *  POST: ranked->key holds the folded chars of the title, up to and
+ *        including its newline, with 0 after it.
+ * REMARKS: Helper function to rankTitles(). The newline is part of the key
+ *          as compareTitles() compares it like any other char. */
+
+void makeTitleKey( RankedTitle *ranked )
+{
+    int ii, word;
+    unsigned long order;
+
+    for ( ii = 0; ii < TITLE_KEY_CHARS; ii++ )
+    {
+        word = ii / ( int )sizeof ( unsigned long );
+        order = ( ii <= ranked->length ) ?
+                    ( unsigned long )foldChar( ranked->title[ii] ) : 0;
+
+        if ( ii % ( int )sizeof ( unsigned long ) == 0 )
+        {
+            ranked->key[word] = 0;
+        }
+        ranked->key[word] = ( ranked->key[word] << 8 ) | order;
+    }
+}
+
+
+
+
+/* NAME: compareRanked
+ * PURPOSE: Provide comparison by title of RankedTitle structures.
+ * IMPORTS: [ const void* ] obj1: item1 to compare
+ *          [ const void* ] obj2: item2 to compare
+ * EXPORTS: [ int ] sortVal: The value of the comparison, as given by
+ *          compareTitles()
+ * ASSERTIONS
+ *  PRE: obj1 and obj2 contain pointers to valid RankedTitle structures,
+ *       with keys made by makeTitleKey().
+ *  POST: sortVal will give the correct comparison value to qsort().
+ * REMARKS: The chars only need comparing when the keys are equal and both
+ *          titles are longer than the key. Otherwise the keys hold the
+ *          newline, and equal keys mean equal titles. */
+
+int compareRanked( const void *obj1, const void *obj2 )
+{
+    int sortVal = 0, ii;
+    const RankedTitle *item1 = ( const RankedTitle* )obj1;
+    const RankedTitle *item2 = ( const RankedTitle* )obj2;
+
+    for ( ii = 0; ( ii < TITLE_KEY_WORDS ) && ( sortVal == 0 ); ii++ )
+    {
+        if ( item1->key[ii] < item2->key[ii] )
+        {
+            sortVal = -1;
+        }
+        else if ( item1->key[ii] > item2->key[ii] )
+        {
+            sortVal = 1;
+        }
+    }
+
+    if ( ( sortVal == 0 ) && ( item1->length >= TITLE_KEY_CHARS ) )
+    {
+        sortVal = compareTitles( item1->title + TITLE_KEY_CHARS,
+                                    item2->title + TITLE_KEY_CHARS );
+    }
+    return sortVal;
+}
+
+
+
+
+/* NAME: rankedChar
+ * PURPOSE: Get the folded char of a title at some depth.
+ * IMPORTS: [ const RankedTitle* ] ranked: the title to get the char of
+ *          [ int ] depth: the index of the char
+ * EXPORTS: [ int ] order: the char folded by foldChar()
+ * ASSERTIONS
+ *  PRE: depth is no more than the title's length.
+ *  POST: N/A
+ * REMARKS: Helper function to radixSortRanked(). Chars inside the key are
+ *          taken from it, so the title's chars are only read past it. */
+
+int rankedChar( const RankedTitle *ranked, int depth )
+{
+    int order, word, shift;
+
+    if ( depth < TITLE_KEY_CHARS )
+    {
+        word = depth / ( int )sizeof ( unsigned long );
+        shift = ( ( int )sizeof ( unsigned long ) - 1 -
+                    depth % ( int )sizeof ( unsigned long ) ) * 8;
+        order = ( int )( ( ranked->key[word] >> shift ) & 0xff );
+    }
+    else
+    {
+        order = foldChar( ranked->title[depth] );
+    }
+    return order;
+}
+
+
+
+
+/* NAME: radixSortRanked
+ * PURPOSE: Sort RankedTitle structures by title, the same order qsort()
+ *          with compareRanked() gives, with a most significant digit first
+ *          radix sort on the folded chars.
+ * IMPORTS: [ RankedTitle* ] ranked: the titles to sort
+ *          [ RankedTitle* ] spare: room for at least count titles
+ *          [ unsigned int ] count: the amount of titles to sort
+ *          [ int ] depth: the amount of chars all the titles share
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: The first depth chars of every title fold to the same chars, none
+ *       of them the newline. Keys were made by makeTitleKey().
+ *  POST: ranked is sorted by title.
+ * REMARKS: Each pass puts the titles into one bucket per folded char at
+ *          depth, then sorts each bucket by the next char. Chars shared by
+ *          titles are read once per title, rather than once per comparison
+ *          as a comparison sort does, which pays off with long shared
+ *          prefixes such as "The ". Titles in the newline's bucket have
+ *          ended, so are equal and left as they are. Titles that are equal
+ *          can end up in any order, which does not matter as they share a
+ *          rank. */
+
+void radixSortRanked( RankedTitle *ranked, RankedTitle *spare,
+                        unsigned int count, int depth )
+{
+    unsigned int counts[256], starts[256], ii, start;
+    int order, newline = foldChar( '\n' );
+
+    if ( count < RADIX_CUTOFF )
+    {
+        insertionSortRanked( ranked, count, depth );
+    }
+    else if ( depth >= RADIX_MAX_DEPTH )
+    {
+        qsort( ( void* )ranked, count, sizeof ( RankedTitle ),
+                    &compareRanked );
+    }
+    else
+    {
+        memset( counts, 0, sizeof ( counts ) );
+        for ( ii = 0; ii < count; ii++ )
+        {
+            counts[rankedChar( &ranked[ii], depth )]++;
+        }
+
+        /* when every title has the same char, there is nothing to move */
+        if ( counts[rankedChar( &ranked[0], depth )] < count )
+        {
+            start = 0;
+            for ( order = 0; order < 256; order++ )
+            {
+                starts[order] = start;
+                start += counts[order];
+            }
+
+            for ( ii = 0; ii < count; ii++ )
+            {
+                spare[starts[rankedChar( &ranked[ii], depth )]++] =
+                                                                ranked[ii];
+            }
+            memcpy( ranked, spare, count * sizeof ( RankedTitle ) );
+        }
+
+        /* sort each bucket by the chars after this one */
+        start = 0;
+        for ( order = 0; order < 256; order++ )
+        {
+            if ( ( order != newline ) && ( counts[order] > 1 ) )
+            {
+                radixSortRanked( &ranked[start], spare, counts[order],
+                                    depth + 1 );
+            }
+            start += counts[order];
+        }
+    }
+}
+
+
+
+
+/* NAME: insertionSortRanked
+ * PURPOSE: Sort a few RankedTitle structures by title.
+ * IMPORTS: [ RankedTitle* ] ranked: the titles to sort
+ *          [ unsigned int ] count: the amount of titles to sort
+ *          [ int ] depth: the amount of chars all the titles share
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: The first depth chars of every title fold to the same chars, none
+ *       of them the newline.
+ *  POST: ranked is sorted by title.
+ * REMARKS: Helper function to radixSortRanked(), for buckets too small for
+ *          another pass to be worth it. */
+
+void insertionSortRanked( RankedTitle *ranked, unsigned int count,
+                            int depth )
+{
+    unsigned int ii, jj;
+    RankedTitle item;
+
+    for ( ii = 1; ii < count; ii++ )
+    {
+        item = ranked[ii];
+        jj = ii;
+        while ( ( jj > 0 ) &&
+                    ( compareFromDepth( &ranked[jj - 1], &item, depth ) > 0 ) )
+        {
+            ranked[jj] = ranked[jj - 1];
+            jj--;
+        }
+        ranked[jj] = item;
+    }
+}
+
+
+
+
+/* NAME: compareFromDepth
+ * PURPOSE: Compare two titles that are known to share their first chars.
+ * IMPORTS: [ const RankedTitle* ] item1: title1 to compare
+ *          [ const RankedTitle* ] item2: title2 to compare
+ *          [ int ] depth: the amount of chars the titles share
+ * EXPORTS: [ int ] sortVal: The value of the comparison, as given by
+ *          compareRanked()
+ * ASSERTIONS
+ *  PRE: The first depth chars of both titles fold to the same chars, none
+ *       of them the newline.
+ *  POST: N/A
+ * REMARKS: Helper function to insertionSortRanked(). Within the key, the
+ *          keys are compared, past it the shared chars are skipped. */
+
+int compareFromDepth( const RankedTitle *item1, const RankedTitle *item2,
+                        int depth )
+{
+    int sortVal;
+
+    if ( depth < TITLE_KEY_CHARS )
+    {
+        sortVal = compareRanked( item1, item2 );
+    }
+    else
+    {
+        sortVal = compareTitles( item1->title + depth, item2->title + depth );
+    }
+    return sortVal;
+}
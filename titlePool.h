@@ -0,0 +1,89 @@
+/* FILE: titlePool.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef TITLEPOOL_H
+#define TITLEPOOL_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "boolean.h"
+
+
+/* engines rankTitles() can sort the distinct titles with */
+#define RANK_QSORT 0
+#define RANK_RADIX 1
+
+
+/* NAME: PooledTitle
+ * PURPOSE: Describe one distinct title held by a TitlePool.
+ * FIELDS:  [ unsigned long ] offset: index of the title's first char in the
+ *          pool's text
+ *          [ unsigned long ] hash: hash of the title's chars, kept so the
+ *          hash table can be grown without hashing every title again
+ *          [ int ] length: the amount of chars in the title, not counting
+ *          the newline that ends it
+ * REMARKS: Private to titlePool.c, other files use getTitle(). */
+
+typedef struct {
+    unsigned long offset;
+    unsigned long hash;
+    int length;
+} PooledTitle;
+
+
+/* NAME: TitlePool
+ * PURPOSE: Store every distinct title once, and give each one an ID, so that
+ *          entries can refer to their title with a single unsigned int.
+ * FIELDS:  [ char* ] text: the distinct titles, each ended by a newline
+ *          [ unsigned long ] size: the amount of chars used in text
+ *          [ unsigned long ] capacity: the amount of chars text has room for
+ *          [ PooledTitle* ] titles: array indexed by ID, of each title
+ *          [ unsigned int ] count: the amount of distinct titles, which is
+ *          also the ID the next new title will get
+ *          [ unsigned int ] titleCapacity: the room in the titles array
+ *          [ unsigned int* ] table: hash table of ID + 1, 0 being empty
+ *          [ unsigned int ] tableSize: the amount of slots in table, always
+ *          a power of 2
+ *          [ unsigned int* ] rank: array indexed by ID of the title's place
+ *          in name order, or NULL until rankTitles() is called
+ *          [ unsigned long ] grows: the amount of times text, titles or
+ *          table was allocated or moved to grow them
+ * REMARKS: Start with initTitlePool() and release with freeTitlePool().
+ *          IDs are given out in the order titles are first seen. */
+
+typedef struct {
+    char *text;
+    unsigned long size;
+    unsigned long capacity;
+    PooledTitle *titles;
+    unsigned int count;
+    unsigned int titleCapacity;
+    unsigned int *table;
+    unsigned int tableSize;
+    unsigned int *rank;
+    unsigned long grows;
+} TitlePool;
+
+
+void initTitlePool( TitlePool *pool );
+int internTitle( TitlePool *pool, const char *title, int length,
+                    unsigned int *id );
+const char* getTitle( const TitlePool *pool, unsigned int id );
+int getTitleLength( const TitlePool *pool, unsigned int id );
+int rankTitles( TitlePool *pool, int engine );
+void freeTitlePool( TitlePool *pool );
+
+
+
+#endif
@@ -0,0 +1,318 @@
+/* FILE: trigram.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Index the trigrams of the distinct titles of a guide, and search
+ *          them for titles containing some text, allowing for typos.
+ * REFERENCE: Approximate substring matching, Sellers, "The theory and
+ *            computation of evolutionary distances", 1980. The q-gram
+ *            lemma, Ukkonen, "Approximate string-matching with q-grams and
+ *            maximal matches", 1992.
+ * LAST MOD: 16/10/2026
+ * COMMENTS: Titles are folded by foldChar(), so searching ignores case the
+ *           same as sorting by name does.
+ */
+
+
+#include "trigram.h"
+
+
+/* one past the largest place foldChar() gives a char */
+#define FOLDED_CHARS 256
+
+/* a bucket from the top bits of the key times Knuth's multiplicative
+ * hash constant, as the low bits of the key are the last char alone */
+#define TRIGRAM_HASH 2654435761UL
+#define TRIGRAM_SHIFT 16
+
+
+static unsigned int hashTrigram( const char *text );
+
+
+
+
+/* NAME: buildTrigramIndex
+ * PURPOSE: Build the trigram index of the titles of a title index.
+ * IMPORTS: [ TrigramIndex* ] index: the index to build
+ *          [ const TitleIndex* ] titles: the titles to index
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: titles was built by buildTitleIndex().
+ *  POST: index holds the trigrams of every title OR an error is output and
+ *        index holds nothing.
+ * REMARKS: Only one title of each rank is indexed, as the others only
+ *          differ by case. Each rank's trigrams are counted, then placed,
+ *          with last remembering the rank that last used each bucket so a
+ *          rank is only put in a bucket once. Linear in the length of the
+ *          distinct titles. */
+
+int buildTrigramIndex( TrigramIndex *index, const TitleIndex *titles )
+{
+    int success = TRUE, pass, ii, length;
+    unsigned int rank, bucket, *last;
+    const char *title;
+
+    index->titles = titles;
+    index->starts = ( unsigned int* )calloc( TRIGRAM_BUCKETS + 1,
+                                                sizeof ( unsigned int ) );
+    index->ranks = NULL;
+    last = ( unsigned int* )malloc( TRIGRAM_BUCKETS *
+                                    sizeof ( unsigned int ) );
+
+    if ( ( index->starts == NULL ) || ( last == NULL ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+
+    /* the first pass counts each bucket's ranks, the second places them */
+    for ( pass = 0; ( pass < 2 ) && ( success ); pass++ )
+    {
+        /* no rank is the count of ranks, so every bucket starts unused */
+        for ( bucket = 0; bucket < TRIGRAM_BUCKETS; bucket++ )
+        {
+            last[bucket] = titles->count;
+        }
+
+        for ( rank = 0; rank < titles->count; rank++ )
+        {
+            title = getTitle( titles->pool, titles->names[rank] );
+            length = getTitleLength( titles->pool, titles->names[rank] );
+
+            for ( ii = 0; ii + 2 < length; ii++ )
+            {
+                bucket = hashTrigram( title + ii );
+                if ( last[bucket] != rank )
+                {
+                    last[bucket] = rank;
+                    if ( pass == 0 )
+                    {
+                        index->starts[bucket + 1]++;
+                    }
+                    else
+                    {
+                        /* starts[bucket] moves up as the bucket fills */
+                        index->ranks[index->starts[bucket]++] = rank;
+                    }
+                }
+            }
+        }
+
+        if ( pass == 0 )
+        {
+            for ( bucket = 1; bucket <= TRIGRAM_BUCKETS; bucket++ )
+            {
+                index->starts[bucket] += index->starts[bucket - 1];
+            }
+            index->ranks = ( unsigned int* )malloc(
+                ( index->starts[TRIGRAM_BUCKETS] + 1 ) *
+                sizeof ( unsigned int ) );
+            if ( index->ranks == NULL )
+            {
+                fprintf( stderr, "Error: Memory not assigned!\n" );
+                success = FALSE;
+            }
+        }
+    }
+
+    if ( success )
+    {
+        /* placing moved each start to where the next bucket starts */
+        for ( bucket = TRIGRAM_BUCKETS; bucket > 0; bucket-- )
+        {
+            index->starts[bucket] = index->starts[bucket - 1];
+        }
+        index->starts[0] = 0;
+    }
+    else
+    {
+        freeTrigramIndex( index );
+    }
+
+    free( last );
+    return success;
+}
+
+
+
+
+/* NAME: searchTitles
+ * PURPOSE: Find the airings of every title containing some text, in any
+ *          case, with up to some amount of typos.
+ * IMPORTS: [ const TrigramIndex* ] index: the index to search
+ *          [ const char* ] text: the text to find, such as "avengers"
+ *          [ int ] edits: the most chars that can be changed, added or
+ *          removed from text for it to be in a title, 0 for text exactly
+ *          [ Vector* ] results: vector of TVEntry to add the entries to
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: index was built by buildTrigramIndex(). text is null-terminated.
+ *       edits is 0 or above.
+ *  POST: The entries are added to results in name order, and time order
+ *        within a title, OR an error is output.
+ * REMARKS: Each edit can break at most 3 of the trigrams of text, so a
+ *          title with a match keeps at least the other trigrams, the
+ *          threshold. The buckets of each trigram of text add one hit to
+ *          their titles, and only titles with enough hits are checked by
+ *          matchTitle(). Short text or many edits leave no threshold, and
+ *          every title is checked. */
+
+int searchTitles( const TrigramIndex *index, const char *text, int edits,
+                    Vector *results )
+{
+    int success = TRUE, ii, textLength, threshold, *column;
+    unsigned int rank, bucket, jj, *hits = NULL;
+    const TitleIndex *titles = index->titles;
+
+    textLength = strlen( text );
+    threshold = textLength - 2 - 3 * edits;
+    column = ( int* )malloc( ( textLength + 1 ) * sizeof ( int ) );
+    if ( threshold > 0 )
+    {
+        hits = ( unsigned int* )calloc( titles->count + 1,
+                                        sizeof ( unsigned int ) );
+    }
+
+    if ( ( column == NULL ) || ( ( threshold > 0 ) && ( hits == NULL ) ) )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else if ( threshold > 0 )
+    {
+        /* a trigram twice in text is counted twice, as the threshold is */
+        for ( ii = 0; ii + 2 < textLength; ii++ )
+        {
+            bucket = hashTrigram( text + ii );
+            for ( jj = index->starts[bucket];
+                    jj < index->starts[bucket + 1]; jj++ )
+            {
+                hits[index->ranks[jj]]++;
+            }
+        }
+    }
+
+    for ( rank = 0; ( rank < titles->count ) && ( success ); rank++ )
+    {
+        if ( ( ( threshold <= 0 ) ||
+                ( hits[rank] >= ( unsigned int )threshold ) ) &&
+                ( matchTitle( getTitle( titles->pool, titles->names[rank] ),
+                        getTitleLength( titles->pool, titles->names[rank] ),
+                        text, textLength, edits, column ) ) )
+        {
+            success = appendVector( results,
+                        titles->postings + titles->starts[rank],
+                        titles->starts[rank + 1] - titles->starts[rank] );
+            if ( !success )
+            {
+                fprintf( stderr, "Error: Memory not assigned!\n" );
+            }
+        }
+    }
+
+    free( column );
+    free( hits );
+    return success;
+}
+
+
+
+
+/* NAME: matchTitle
+ * PURPOSE: Check if a title contains some text, in any case, with up to
+ *          some amount of typos.
+ * IMPORTS: [ const char* ] title: the title to check
+ *          [ int ] titleLength: the amount of chars in title
+ *          [ const char* ] text: the text to find
+ *          [ int ] textLength: the amount of chars in text
+ *          [ int ] edits: the most chars that can be changed, added or
+ *          removed from text for it to be in title
+ *          [ int* ] column: room for textLength + 1 ints, to work in
+ * EXPORTS: [ int ] found: TRUE if title has text in it, else FALSE
+ * ASSERTIONS
+ *  PRE: title and text point to at least their lengths in chars.
+ *  POST: N/A
+ * REMARKS: column[ii] is the fewest edits for the first ii chars of text
+ *          to end at the title char reached, and a match can start at any
+ *          char of the title, so column[0] stays 0. O(title x text), so it
+ *          is only used on titles the index could not rule out. */
+
+int matchTitle( const char *title, int titleLength, const char *text,
+                    int textLength, int edits, int *column )
+{
+    int ii, jj, diagonal, above, best;
+    int found = ( textLength <= edits );
+
+    for ( ii = 0; ii <= textLength; ii++ )
+    {
+        column[ii] = ii;
+    }
+
+    for ( jj = 0; ( jj < titleLength ) && ( !found ); jj++ )
+    {
+        diagonal = column[0];
+        for ( ii = 1; ii <= textLength; ii++ )
+        {
+            above = column[ii];
+            best = diagonal + ( foldChar( title[jj] ) !=
+                                foldChar( text[ii - 1] ) );
+            if ( above + 1 < best )
+            {
+                best = above + 1;
+            }
+            if ( column[ii - 1] + 1 < best )
+            {
+                best = column[ii - 1] + 1;
+            }
+            column[ii] = best;
+            diagonal = above;
+        }
+        found = ( column[textLength] <= edits );
+    }
+    return found;
+}
+
+
+
+
+/* NAME: freeTrigramIndex
+ * PURPOSE: Release everything held by a trigram index.
+ * IMPORTS: [ TrigramIndex* ] index: the index to release
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: index was given to buildTrigramIndex().
+ *  POST: index holds nothing.
+ * REMARKS: Safe to call on an index that has already been freed. The title
+ *          index is not freed, as this index does not own it. */
+
+void freeTrigramIndex( TrigramIndex *index )
+{
+    free( index->starts );
+    free( index->ranks );
+    index->starts = NULL;
+    index->ranks = NULL;
+}
+
+
+
+
+/* NAME: hashTrigram
+ * PURPOSE: Give the bucket of the trigram at the start of some text.
+ * IMPORTS: [ const char* ] text: the three chars of the trigram
+ * EXPORTS: [ unsigned int ] bucket: below TRIGRAM_BUCKETS, the same for
+ *          trigrams that only differ by case
+ * ASSERTIONS
+ *  PRE: text points to at least 3 chars.
+ *  POST: N/A
+ * REMARKS: Private to this file. */
+
+unsigned int hashTrigram( const char *text )
+{
+    unsigned long key = ( ( unsigned long )foldChar( text[0] ) *
+                            FOLDED_CHARS + foldChar( text[1] ) ) *
+                            FOLDED_CHARS + foldChar( text[2] );
+
+    return ( unsigned int )( ( key * TRIGRAM_HASH ) >> TRIGRAM_SHIFT ) &
+            ( TRIGRAM_BUCKETS - 1 );
+}
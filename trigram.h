@@ -0,0 +1,64 @@
+/* FILE: trigram.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 16/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef TRIGRAM_H
+#define TRIGRAM_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "vector.h"
+#include "comparison.h"
+#include "titlePool.h"
+#include "titleIndex.h"
+#include "boolean.h"
+
+
+/* the amount of buckets trigrams are hashed into, a power of 2 */
+#define TRIGRAM_BUCKETS 65536
+
+
+/* NAME: TrigramIndex
+ * PURPOSE: Hold, for every trigram of the titles, the titles it is in, so
+ *          titles containing some text, or nearly containing it, can be
+ *          found without checking every title.
+ * FIELDS:  [ const TitleIndex* ] titles: the titles indexed, and their
+ *          entries
+ *          [ unsigned int* ] starts: array indexed by bucket of where the
+ *          bucket's ranks start, with starts[TRIGRAM_BUCKETS] the amount of
+ *          ranks
+ *          [ unsigned int* ] ranks: the ranks of the titles with a trigram
+ *          in each bucket, in rank order, and each only once per bucket
+ * REMARKS: Made by buildTrigramIndex() and released by freeTrigramIndex().
+ *          The title index is not copied, so it must outlive this index.
+ *          Trigrams are hashed, so a bucket can hold titles without the
+ *          trigram looked for, and every title found is checked. */
+
+typedef struct {
+    const TitleIndex *titles;
+    unsigned int *starts;
+    unsigned int *ranks;
+} TrigramIndex;
+
+
+int buildTrigramIndex( TrigramIndex *index, const TitleIndex *titles );
+int searchTitles( const TrigramIndex *index, const char *text, int edits,
+                    Vector *results );
+int matchTitle( const char *title, int titleLength, const char *text,
+                    int textLength, int edits, int *column );
+void freeTrigramIndex( TrigramIndex *index );
+
+
+
+#endif
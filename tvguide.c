@@ -4,7 +4,7 @@
  * PURPOSE: Accept command line arguments and output a sorted, filtered array
  *          to screen and file as requested from the user.
  * REFERENCE: https://stackoverflow.com/a/26226613; M.M's answer
- * LAST MOD: 27/05/2018
+ * LAST MOD: 17/10/2026
  * COMMENTS: None
  */
 
@@ -14,14 +14,143 @@
 
 #include "interface.h"
 #include "io.h"
-#include "list.h"
+#include "vector.h"
+#include "sort.h"
+#include "parallelSort.h"
+#include "filter.h"
 #include "comparison.h"
+#include "query.h"
+#include "titleIndex.h"
+#include "trigram.h"
+#include "schedule.h"
+#include "writer.h"
 /*#include "unittest.h"*/
 
 
-static int processArgs( char *argv[] );
-static int copyToArray( LinkedList *list, TVEntry *array );
-static int filter( TVEntry *array, char *day, int arraySize );
+/* queries that can be given instead of choosing a day */
+#define QUERY_NONE 0
+#define QUERY_RANGE 1
+#define QUERY_WINDOW 2
+#define QUERY_NEXT 3
+#define QUERY_TITLES 4
+#define QUERY_SEARCH 5
+#define QUERY_SCHEDULE 6
+
+/* the longest line of a query file, and the chars between its words */
+#define QUERY_LINE_SIZE 1024
+#define QUERY_SPACE " \t\r\n"
+
+/* the sorts a day can be cached in, by FormattedDays */
+#define SORTED_TIME 0
+#define SORTED_NAME 1
+#define SORTED_TYPES 2
+
+
+/* NAME: Options
+ * PURPOSE: Hold the settings given on the command line.
+ * FIELDS:  [ char* ] inputFile: name of the file to read the guide from
+ *          [ char* ] outputFile: name of the file to write the guide to
+ *          [ int ] mapped: TRUE to memory map the input with
+ *          readMappedFile() instead of reading it with readFile()
+ *          [ int ] threads: the amount of threads to parse a mapped
+ *          input with
+ *          [ int ] stream: TRUE to only keep the chosen day while reading
+ *          the input, rather than reading every day and filtering after
+ *          [ int ] radix: TRUE to sort by name with the radix sort engine,
+ *          rather than qsort()
+ *          [ int ] sortThreads: the amount of threads to sort by name with
+ *          [ int ] query: QUERY_NONE to choose a day, or the query to answer
+ *          [ unsigned int ] days: the days of a QUERY_WINDOW, as given by
+ *          parseDays()
+ *          [ unsigned int ] from: the start of the query, a minute of the
+ *          week for QUERY_RANGE and QUERY_NEXT, or of the day for
+ *          QUERY_WINDOW
+ *          [ unsigned int ] to: the end of the query, the same as from
+ *          [ int ] count: the amount of entries a QUERY_NEXT finds
+ *          [ char* ] titleFrom: the prefix of the first titles a
+ *          QUERY_TITLES finds
+ *          [ char* ] titleTo: the prefix of the last titles it finds
+ *          [ char* ] search: the text the titles a QUERY_SEARCH finds
+ *          contain
+ *          [ int ] edits: the most typos a QUERY_SEARCH allows for
+ *          [ char* ] show: the title of the show a QUERY_SCHEDULE finds
+ *          [ int ] week: TRUE to write every day of the week to a file of
+ *          its own, rather than choosing a day
+ *          [ char* ] queryFile: name of the file of queries to answer
+ *          rather than choosing a day, or NULL for none
+ * REMARKS: Filled in by parseOptions(). */
+
+typedef struct {
+    char *inputFile;
+    char *outputFile;
+    int mapped;
+    int threads;
+    int stream;
+    int radix;
+    int sortThreads;
+    int query;
+    unsigned int days;
+    unsigned int from;
+    unsigned int to;
+    int count;
+    char *titleFrom;
+    char *titleTo;
+    char *search;
+    int edits;
+    char *show;
+    int week;
+    char *queryFile;
+} Options;
+
+
+/* NAME: FormattedDays
+ * PURPOSE: Hold each day of the entries, sorted and formatted in each sort,
+ *          once it has been asked for, so later queries of it only write.
+ * FIELDS:  [ TVEntry* ] array: the entries, indexed by day
+ *          [ DayIndex ] index: where each day of array starts
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ int ] ranked: TRUE once the titles have been ranked
+ *          [ char* [][] ] text: array indexed by day code - 1 and sort of
+ *          the day's guide, as given by formatGuide(), or NULL until asked
+ *          for
+ *          [ long [][] ] size: the amount of chars in each text
+ * REMARKS: Filled in by formatDay() and released by freeFormattedDays(). */
+
+typedef struct {
+    TVEntry *array;
+    DayIndex index;
+    TitlePool *titles;
+    int ranked;
+    char *text[DAYS_PER_WEEK][SORTED_TYPES];
+    long size[DAYS_PER_WEEK][SORTED_TYPES];
+} FormattedDays;
+
+
+static int parseOptions( int argc, char *argv[], Options *options );
+static int processArgs( Options *options );
+static int processMappedGuide( Options *options );
+static int inputChoices( Options *options, char day[], char sortType[] );
+static int outputGuide( Options *options, TVEntry *array, int arraySize,
+                        TitlePool *titles, char *day, char *sortType );
+static int outputQuery( Options *options, TVEntry *array, int arraySize,
+                        TitlePool *titles, char *sortType );
+static int outputWeek( Options *options, TVEntry *array, int arraySize,
+                        TitlePool *titles, char *sortType );
+static int outputBatch( Options *options, TVEntry *array, int arraySize,
+                        TitlePool *titles );
+static int parseQuery( char line[], int *dayCode, int *sort,
+                        char **output );
+static int formatDay( Options *options, FormattedDays *days, int dayCode,
+                        int sort );
+static void freeFormattedDays( FormattedDays *days );
+static int suffixFilename( const char *outputFile, const char *suffix,
+                        char **filename );
+static int sortNames( Options *options, TVEntry *array, int arraySize,
+                        TitlePool *titles );
+static int rankNames( Options *options, TitlePool *titles );
+static int sortRanked( Options *options, TVEntry *array, int arraySize,
+                        TitlePool *titles );
 
 
 
@@ -33,7 +162,8 @@ static int filter( TVEntry *array, char *day, int arraySize );
  *          a filtered, sorted TV guide to screen and into a specified output
  *          file.
  * IMPORTS: [ int ] argc: amount of input CL arguments
- *          [ char* [] ] argv: CL arguments
+ *          [ char* [] ] argv: CL arguments, any options then the input and
+ *          output files
  * EXPORTS: [ int ] status: success or failure of program
  *          0 is used for success, 1 is used for all errors.
  * ASSERTIONS
@@ -47,20 +177,61 @@ int main( int argc, char *argv[] )
     /* status is the variable returned to the shell, the exit status
      * of the program. I set it to 0 for success, and 1 for error. */
     int status = 0;
+    Options options;
 
-    /* Require 3 arguments: the executable, input file, and output file */
-    if ( argc != 3 )
+    /* Require the input file and output file, after any options */
+    if ( !parseOptions( argc, argv, &options ) )
     {
         fprintf( stderr, "Error: Enter 2 arguments, the name of input and "
-    "output files.  \nExample: ./ProductionBuild input.txt output.txt \n" );
+    "output files.  \nExample: ./ProductionBuild input.txt output.txt \n"
+    "Options (before the files):\n"
+    "  -m    memory map the input file instead of reading it line by line\n"
+    "  -j N  parse the memory mapped input with N threads (implies -m)\n"
+    "  -s    stream, keeping only the chosen day while reading the input\n"
+    "  -r    sort by name with a radix sort instead of qsort()\n"
+    "  -p N  sort by name with qsort() on N threads, not used by -r or\n"
+    "        when sorting by time\n" );
+        fprintf( stderr,
+    "  -t \"DAY HH:MM\" \"DAY HH:MM\"  instead of choosing a day, list the\n"
+    "        shows from one time of the week up to another\n"
+    "  -w DAYS HH:MM HH:MM  instead of choosing a day, list the shows from\n"
+    "        one time up to another on each of DAYS, which is a day,\n"
+    "        DAY-DAY, weekdays, weekend or everyday\n" );
+        fprintf( stderr,
+    "  -n \"DAY HH:MM\" K  instead of choosing a day, list the next K shows\n"
+    "        from a time of the week\n"
+    "  -b PREFIX  instead of choosing a day, list the shows with titles\n"
+    "        starting with PREFIX, in any case\n"
+    "  -B FROM TO  instead of choosing a day, list the shows with titles\n"
+    "        from FROM to TO, such as a c for every title from A to C\n" );
+        fprintf( stderr,
+    "  -c TEXT  instead of choosing a day, list the shows with titles\n"
+    "        containing TEXT, in any case\n"
+    "  -f TEXT K  the same as -c, but finding TEXT with up to K typos\n"
+    "  -a TITLE  instead of choosing a day, list every time the show\n"
+    "        TITLE airs in the week, in any case\n" );
+        fprintf( stderr,
+    "  -W    instead of choosing a day, write each day of the week to a\n"
+    "        file of its own, such as output_monday.txt for output.txt\n"
+    "  -q FILE  instead of choosing a day, answer each line of FILE, such\n"
+    "        as \"monday name\" or \"friday time friday.txt\", writing to\n"
+    "        output_monday_name.txt and so on when no file is given\n" );
         status = 1;
     }
     else
     {
         /* status is equal to the negation of what processArgs() returns.
          * this is because processArgs returns 0 on failure, and 1 on success
-         * and returning to the shell uses the reverse convention. */
-        status = !processArgs( argv );
+         * and returning to the shell uses the reverse convention.
+         * A mapped input is parsed in place instead of with fgets(). */
+        if ( options.mapped )
+        {
+            status = !processMappedGuide( &options );
+        }
+        else
+        {
+            status = !processArgs( &options );
+        }
     }
     return status; /* returns to shell: 1 on error, 0 on success */
 }
@@ -68,9 +239,289 @@ int main( int argc, char *argv[] )
 
 
 
+/* NAME: parseOptions
+ * PURPOSE: Read the options and the two file names from the CL arguments.
+ * IMPORTS: [ int ] argc: amount of input CL arguments
+ *          [ char* [] ] argv: CL arguments
+ *          [ Options* ] options: structure to store the settings into
+ * EXPORTS: [ int ] valid: validity of the CL arguments
+ *          FALSE is used for invalid, TRUE for valid
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: options holds the settings given OR valid is FALSE.
+ * REMARKS: Options must come before the input and output files. */
+
+int parseOptions( int argc, char *argv[], Options *options )
+{
+    int valid = TRUE, ii = 1;
+
+    options->inputFile = NULL;
+    options->outputFile = NULL;
+    options->mapped = FALSE;
+    options->threads = 1;
+    options->stream = FALSE;
+    options->radix = FALSE;
+    options->sortThreads = 1;
+    options->query = QUERY_NONE;
+    options->week = FALSE;
+    options->queryFile = NULL;
+
+    /* read options until the first argument that is not one */
+    while ( ( ii < argc ) && ( argv[ii][0] == '-' ) && ( valid ) )
+    {
+        if ( strcmp( argv[ii], "-m" ) == 0 )
+        {
+            options->mapped = TRUE;
+        }
+        else if ( strcmp( argv[ii], "-s" ) == 0 )
+        {
+            options->stream = TRUE;
+        }
+        else if ( strcmp( argv[ii], "-r" ) == 0 )
+        {
+            options->radix = TRUE;
+        }
+        else if ( strcmp( argv[ii], "-W" ) == 0 )
+        {
+            options->week = TRUE;
+        }
+        /* the queries to answer are in the file after -q */
+        else if ( strcmp( argv[ii], "-q" ) == 0 )
+        {
+            if ( ii + 1 < argc )
+            {
+                options->queryFile = argv[ii + 1];
+                ii++;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -q needs a file of queries\n" );
+                valid = FALSE;
+            }
+        }
+        /* the thread count is the argument after -j */
+        else if ( strcmp( argv[ii], "-j" ) == 0 )
+        {
+            if ( ( ii + 1 < argc ) && ( atoi( argv[ii + 1] ) > 0 ) )
+            {
+                options->mapped = TRUE;
+                options->threads = atoi( argv[ii + 1] );
+                ii++;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -j needs a thread count above 0\n" );
+                valid = FALSE;
+            }
+        }
+        /* the sort's thread count is the argument after -p */
+        else if ( strcmp( argv[ii], "-p" ) == 0 )
+        {
+            if ( ( ii + 1 < argc ) && ( atoi( argv[ii + 1] ) > 0 ) )
+            {
+                options->sortThreads = atoi( argv[ii + 1] );
+                ii++;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -p needs a thread count above 0\n" );
+                valid = FALSE;
+            }
+        }
+        /* a range is the two times of the week after -t */
+        else if ( strcmp( argv[ii], "-t" ) == 0 )
+        {
+            if ( ( ii + 2 < argc ) &&
+                    ( parseMoment( argv[ii + 1], &options->from ) ) &&
+                    ( parseMoment( argv[ii + 2], &options->to ) ) )
+            {
+                options->query = QUERY_RANGE;
+                ii += 2;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -t needs two times of the week, "
+                    "such as \"friday 18:00\" \"saturday 02:00\"\n" );
+                valid = FALSE;
+            }
+        }
+        /* a window is the days and two times of the day after -w */
+        else if ( strcmp( argv[ii], "-w" ) == 0 )
+        {
+            if ( ( ii + 3 < argc ) &&
+                    ( parseDays( argv[ii + 1], &options->days ) ) &&
+                    ( parseClock( argv[ii + 2], &options->from ) ) &&
+                    ( parseClock( argv[ii + 3], &options->to ) ) )
+            {
+                options->query = QUERY_WINDOW;
+                ii += 3;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -w needs days and two times of "
+                    "the day, such as weekdays 06:00 09:00\n" );
+                valid = FALSE;
+            }
+        }
+        /* the next shows are from the time of the week after -n */
+        else if ( strcmp( argv[ii], "-n" ) == 0 )
+        {
+            if ( ( ii + 2 < argc ) &&
+                    ( parseMoment( argv[ii + 1], &options->from ) ) &&
+                    ( atoi( argv[ii + 2] ) > 0 ) )
+            {
+                options->query = QUERY_NEXT;
+                options->count = atoi( argv[ii + 2] );
+                ii += 2;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -n needs a time of the week and an "
+                    "amount of shows above 0, such as \"friday 18:00\" 5\n" );
+                valid = FALSE;
+            }
+        }
+        /* titles are browsed by the prefix after -b */
+        else if ( strcmp( argv[ii], "-b" ) == 0 )
+        {
+            if ( ii + 1 < argc )
+            {
+                options->query = QUERY_TITLES;
+                options->titleFrom = argv[ii + 1];
+                options->titleTo = argv[ii + 1];
+                ii++;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -b needs the start of a title\n" );
+                valid = FALSE;
+            }
+        }
+        /* or by the range of prefixes after -B */
+        else if ( strcmp( argv[ii], "-B" ) == 0 )
+        {
+            if ( ii + 2 < argc )
+            {
+                options->query = QUERY_TITLES;
+                options->titleFrom = argv[ii + 1];
+                options->titleTo = argv[ii + 2];
+                ii += 2;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -B needs the start of the first "
+                    "and last titles\n" );
+                valid = FALSE;
+            }
+        }
+        /* titles are searched for the text after -c */
+        else if ( strcmp( argv[ii], "-c" ) == 0 )
+        {
+            if ( ii + 1 < argc )
+            {
+                options->query = QUERY_SEARCH;
+                options->search = argv[ii + 1];
+                options->edits = 0;
+                ii++;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -c needs the text to search for\n" );
+                valid = FALSE;
+            }
+        }
+        /* or for the text after -f, with the typos after that */
+        else if ( strcmp( argv[ii], "-f" ) == 0 )
+        {
+            if ( ( ii + 2 < argc ) && ( atoi( argv[ii + 2] ) > 0 ) )
+            {
+                options->query = QUERY_SEARCH;
+                options->search = argv[ii + 1];
+                options->edits = atoi( argv[ii + 2] );
+                ii += 2;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -f needs the text to search for and "
+                    "an amount of typos above 0, such as avengrs 1\n" );
+                valid = FALSE;
+            }
+        }
+        /* a show's schedule is of the title after -a */
+        else if ( strcmp( argv[ii], "-a" ) == 0 )
+        {
+            if ( ii + 1 < argc )
+            {
+                options->query = QUERY_SCHEDULE;
+                options->show = argv[ii + 1];
+                ii++;
+            }
+            else
+            {
+                fprintf( stderr, "Error: -a needs the title of a show\n" );
+                valid = FALSE;
+            }
+        }
+        else
+        {
+            fprintf( stderr, "Error: Unknown option %s\n", argv[ii] );
+            valid = FALSE;
+        }
+        ii++;
+    }
+
+    /* streaming keeps only the chosen day, and a query has none */
+    if ( ( valid ) && ( options->stream ) &&
+            ( options->query != QUERY_NONE ) )
+    {
+        fprintf( stderr, "Error: -s can not be used with a query\n" );
+        valid = FALSE;
+    }
+
+    /* the radix sort and its counting sort run on one thread */
+    if ( ( valid ) && ( options->radix ) && ( options->sortThreads > 1 ) )
+    {
+        fprintf( stderr, "Error: -p can not be used with -r\n" );
+        valid = FALSE;
+    }
+
+    /* the week is every day, so it has no one day to stream or query */
+    if ( ( valid ) && ( options->week ) &&
+            ( ( options->stream ) || ( options->query != QUERY_NONE ) ) )
+    {
+        fprintf( stderr, "Error: -W can not be used with -s or a query\n" );
+        valid = FALSE;
+    }
+
+    /* and each query of a file chooses its own day */
+    if ( ( valid ) && ( options->queryFile != NULL ) &&
+            ( ( options->stream ) || ( options->query != QUERY_NONE ) ||
+                ( options->week ) ) )
+    {
+        fprintf( stderr, "Error: -q can not be used with -s, -W or a "
+                    "query\n" );
+        valid = FALSE;
+    }
+
+    /* exactly the input and output files must be left */
+    if ( ( valid ) && ( argc - ii == 2 ) )
+    {
+        options->inputFile = argv[ii];
+        options->outputFile = argv[ii + 1];
+    }
+    else
+    {
+        valid = FALSE;
+    }
+    return valid;
+}
+
+
+
+
 /* NAME: processArgs
  * PURPOSE: Helper function to main() to ease readability. 
- * IMPORTS: [ char* [] ] argv: CL arguments
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
  * EXPORTS: [ int ] success: success or failure of the function
  *          FALSE (0) is used for failure, TRUE (!0) is used for success
  * ASSERTIONS
@@ -83,186 +534,821 @@ int main( int argc, char *argv[] )
  *          just removing it from main(), but I am not sure how feasible
  *          this would be. */
 
-int processArgs( char *argv[] )
+int processArgs( Options *options )
 {
     int success = TRUE;
-
-    /* function to pass to qsort() */
-    int ( *compare )( const void*, const void* );
-    int arraySize;
+    int arraySize, dayCode;
     char day[DAY_SIZE], sortType[SORT_SIZE];
     TVEntry *array;
 
-    /* list stores the linked list, and will be equal to NULL
-     * if the function failed */
-    LinkedList *list = createLinkedList( );
+    /* titles of the entries, which the entries refer to by ID */
+    TitlePool titles;
+
+    /* entries stores the entries read in one contiguous block, which
+     * becomes the array that is sorted and output */
+    Vector entries;
+
+    initTitlePool( &titles );
+    initVector( &entries, sizeof ( TVEntry ) );
+
+    /* passes 2 precreated arrays to input user response into. When
+     * streaming, readFile() is only to store the chosen day */
+    dayCode = inputChoices( options, day, sortType );
+
+    /* readFile() returns a success code that is tested,
+     * a value of 0 means failure, and 1 is success.
+     * It is given the input file and the vector to store into */
+    if ( readFile( options->inputFile, &entries, &titles, dayCode ) )
+    {
+        /* the vector hands its storage off as the array, so the entries
+         * are never copied. It is NULL when there were no entries */
+        arraySize = entries.length;
+        array = ( TVEntry* )releaseVector( &entries );
+
+        /* sort, filter and output to screen and file */
+        if ( options->queryFile != NULL )
+        {
+            success = outputBatch( options, array, arraySize, &titles );
+        }
+        else if ( options->week )
+        {
+            success = outputWeek( options, array, arraySize, &titles,
+                                    sortType );
+        }
+        else
+        {
+            success = ( options->query != QUERY_NONE ) ?
+                outputQuery( options, array, arraySize, &titles, sortType ) :
+                outputGuide( options, array, arraySize, &titles, day,
+                                sortType );
+        }
+
+        free( array ); /* IO done, so array can be free'd */
+        array = NULL; /* set the array to NULL after its unallocated */
+    }
+    else /* i.e. file read was unsuccessful */
+    {
+        success = FALSE;
+    }
+
+    freeVector( &entries );
+    freeTitlePool( &titles );
+
+    return success;
+}
+
+
+
+
+/* NAME: processMappedGuide
+ * PURPOSE: Same as processArgs(), but the input file is memory mapped and
+ *          parsed in place rather than read line by line with fgets().
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE:  N/A
+ *  POST: A sorted, filtered TV guide will be output to screen and into the
+ *        user specified file OR a relevant error message will be output.
+ * REMARKS: Each title is interned into the guide's pool as it is parsed,
+ *          so the mapping is unmapped before anything is sorted or output,
+ *          and the entries refer to their titles by pool ID. */
 
-    /* test if the function failed */
-    if ( list == NULL )
+int processMappedGuide( Options *options )
+{
+    int success = TRUE, dayCode;
+    char day[DAY_SIZE], sortType[SORT_SIZE];
+    MappedGuide guide;
+
+    /* when streaming, the parse is only to store the chosen day */
+    dayCode = inputChoices( options, day, sortType );
+
+    if ( !readMappedFile( options->inputFile, &guide,
+                                options->threads, dayCode ) )
     {
-        success = FALSE; /* fail status */
+        success = FALSE;
+    }
+    else
+    {
+        /* sort, filter and output to screen and file */
+        if ( options->queryFile != NULL )
+        {
+            success = outputBatch( options, guide.entries, guide.length,
+                                    &guide.titles );
+        }
+        else if ( options->week )
+        {
+            success = outputWeek( options, guide.entries, guide.length,
+                                    &guide.titles, sortType );
+        }
+        else
+        {
+            success = ( options->query != QUERY_NONE ) ?
+                outputQuery( options, guide.entries, guide.length,
+                                &guide.titles, sortType ) :
+                outputGuide( options, guide.entries, guide.length,
+                                &guide.titles, day, sortType );
+        }
+
+        freeMappedGuide( &guide );
+    }
+
+    return success;
+}
+
+
+
+
+/* NAME: inputChoices
+ * PURPOSE: Ask the user for the day and sort type, or only the sort type
+ *          when a query or the whole week chooses the entries instead, or
+ *          nothing when a file of queries chooses both.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ char [] ] day: string to store the user's day into
+ *          [ char [] ] sortType: string to store the user's sort into
+ * EXPORTS: [ int ] dayCode: getDay() code of the only day the input needs
+ *          to be stored for, or 0 to store every day
+ * ASSERTIONS
+ *  PRE: day and sortType are of correct size.
+ *  POST: sortType is valid, and so is day unless there is a query or the
+ *        whole week is written, OR neither is set for a file of queries.
+ * REMARKS: Only streaming stores a single day. */
+
+int inputChoices( Options *options, char day[], char sortType[] )
+{
+    int dayCode = 0;
+
+    if ( options->queryFile != NULL )
+    {
+        /* the queries are read once the guide is */
+    }
+    else if ( ( options->query != QUERY_NONE ) || ( options->week ) )
+    {
+        inputSort( sortType );
     }
     else
     {
-        /* passes 2 precreated arrays to input user response into */
         inputStrings( day, sortType );
+        dayCode = ( options->stream ) ? getDay( day ) : 0;
+    }
+    return dayCode;
+}
+
+
+
+
+/* NAME: outputGuide
+ * PURPOSE: Take the user's day from an array of entries, sort it as the
+ *          user selected, and output it to screen and the output file.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ TVEntry* ] array: the entries read from the input file
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ char* ] day: string with the user's choice of day
+ *          [ char* ] sortType: string with the user's choice of sort
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: day and sortType are valid, as given by inputStrings().
+ *  POST: A sorted, filtered TV guide will be output to screen and into the
+ *        user specified file OR a relevant error message will be output.
+ * REMARKS: Shared by processArgs() and processMappedGuide(), as once the
+ *          entries are in an array it does not matter how they were read.
+ *          The entries read are filtered to the user's day first, so only
+ *          that day is sorted. filter() matches a column of day codes with
+ *          the CPU's vector kernel, which is quicker than grouping every
+ *          day with indexDays() when only one of them is wanted.
+ *          Sorting by name ranks the distinct titles first, so qsort() only
+ *          compares two integers per comparison of entries, or with the
+ *          radix engine, the titles are radix sorted and the entries
+ *          counting sorted by rank. Without it, the entries are sorted by
+ *          parallelSort(), which is qsort() unless more than one thread is
+ *          asked for. Sorting by time is done by sortByTime() in linear
+ *          time, which beats a comparison sort on any amount of threads. */
+
+int outputGuide( Options *options, TVEntry *array, int arraySize,
+                    TitlePool *titles, char *day, char *sortType )
+{
+    int success = TRUE;
+
+    /* keep only the user's day, in the order it was read. A streamed input
+     * only held the chosen day already */
+    if ( !options->stream )
+    {
+        arraySize = filter( array, getDay( day ), arraySize );
+    }
 
-        /* readFile() returns a success code that is tested,
-         * a value of 0 means failure, and 1 is success.
-         * It is given argv[1] (input file) and the list to store into */
-        if ( readFile( argv[1], list ) )
+    /* the sort is dependent on what sortType was selected. Name sorting
+     * gives qsort() the ranks of the titles to compare, while time sorting
+     * is a counting sort on the key with no comparisons at all */
+    if ( strncmp( sortType, "name", SORT_SIZE ) == 0 )
+    {
+        success = sortNames( options, array, arraySize, titles );
+    }
+    else
+    {
+        success = sortByTime( array, arraySize );
+    }
+
+    /* the guide is formatted once for both the screen and the file, a
+     * chunk at a time while the one before is written, if writing returns
+     * an error (0), set approp. status */
+    if ( success )
+    {
+        success = writeGuideAsync( options->outputFile, array, arraySize,
+                                    titles, EMPTY_DAY );
+    }
+
+    return success;
+}
+
+
+
+
+/* NAME: outputQuery
+ * PURPOSE: Find the entries a query asks for, sort them as the user
+ *          selected, and output them to screen and the output file.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments, with
+ *          the query to answer
+ *          [ TVEntry* ] array: the entries read from the input file
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ char* ] sortType: string with the user's choice of sort
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: options->query is not QUERY_NONE, sortType is valid, as given by
+ *       inputSort().
+ *  POST: The entries of the query will be output to screen and into the
+ *        user specified file OR a relevant error message will be output.
+ * REMARKS: For a span, array is put in time order to index it, and the
+ *          query's entries copied out of it. The next shows are picked out
+ *          of array as it is instead, as one query is quicker than building
+ *          an index. By time, the entries are left in the order they air
+ *          from the start of the query, as sorting them again would put a
+ *          query running on from sunday into monday in the wrong order.
+ *          Titles are browsed with a title index, and searched with a
+ *          trigram index of it, which both give them in name order already,
+ *          so they are only sorted by time, which keeps shows airing at the
+ *          same minute in name order. A show's schedule is one title, in
+ *          time order, so it is right for either sort. */
+
+int outputQuery( Options *options, TVEntry *array, int arraySize,
+                    TitlePool *titles, char *sortType )
+{
+    int success, byName = ( strncmp( sortType, "name", SORT_SIZE ) == 0 );
+    TimeIndex index;
+    TitleIndex titleIndex;
+    TrigramIndex trigrams;
+    Schedule schedule;
+    Vector results;
+
+    initVector( &results, sizeof ( TVEntry ) );
+
+    if ( options->query == QUERY_TITLES )
+    {
+        success = ( buildTitleIndex( &titleIndex, titles, array, arraySize,
+                        ( options->radix ) ? RANK_RADIX : RANK_QSORT ) ) &&
+                    ( queryTitles( &titleIndex, options->titleFrom,
+                                    options->titleTo, &results ) );
+        freeTitleIndex( &titleIndex );
+    }
+    else if ( options->query == QUERY_SEARCH )
+    {
+        success = buildTitleIndex( &titleIndex, titles, array, arraySize,
+                        ( options->radix ) ? RANK_RADIX : RANK_QSORT );
+        if ( success )
         {
-            /* malloc() the amount of LL entries */
-            arraySize = getLength( list );
-            array = ( TVEntry* )malloc( arraySize * sizeof ( TVEntry ) );
+            success = ( buildTrigramIndex( &trigrams, &titleIndex ) ) &&
+                        ( searchTitles( &trigrams, options->search,
+                                        options->edits, &results ) );
+            freeTrigramIndex( &trigrams );
+        }
+        freeTitleIndex( &titleIndex );
+    }
+    else if ( options->query == QUERY_SCHEDULE )
+    {
+        success = ( buildSchedule( &schedule, titles, array, arraySize ) ) &&
+                    ( querySchedule( &schedule, options->show, &results ) );
+        freeSchedule( &schedule );
+    }
+    else if ( options->query == QUERY_NEXT )
+    {
+        success = selectNext( array, arraySize, options->from,
+                                options->count, &results );
+    }
+    else if ( !buildTimeIndex( &index, array, arraySize ) )
+    {
+        /* the index could not be built, so there is nothing to query */
+        success = FALSE;
+    }
+    else if ( options->query == QUERY_RANGE )
+    {
+        success = queryRange( &index, options->from, options->to,
+                                &results );
+    }
+    else
+    {
+        success = queryWindow( &index, options->days, options->from,
+                                options->to, &results );
+    }
 
-            /* if the malloc failed, the array is NULL */
-            if ( array == NULL )
-            {
-                fprintf( stderr, "Error: Memory not assigned!\n" );
-                success = FALSE;
-            }
-            else
+    if ( !success )
+    {
+        /* nothing was found to sort */
+    }
+    else if ( options->query == QUERY_SCHEDULE )
+    {
+        /* the airings of one show are in time order, and in name order */
+    }
+    else if ( ( options->query == QUERY_TITLES ) ||
+                ( options->query == QUERY_SEARCH ) )
+    {
+        success = ( byName ) || ( sortByTime( ( TVEntry* )results.data,
+                                                results.length ) );
+    }
+    else if ( byName )
+    {
+        success = sortNames( options, ( TVEntry* )results.data,
+                                results.length, titles );
+    }
+
+    if ( success )
+    {
+        success = writeGuideAsync( options->outputFile,
+                                    ( TVEntry* )results.data, results.length,
+                                    titles, EMPTY_QUERY );
+    }
+
+    freeVector( &results );
+    return success;
+}
+
+
+
+
+/* NAME: outputWeek
+ * PURPOSE: Sort every day of an array of entries as the user selected, and
+ *          write each day to a file of its own.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ TVEntry* ] array: the entries read from the input file
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ char* ] sortType: string with the user's choice of sort
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: sortType is valid, as given by inputSort().
+ *  POST: Each day's file holds what outputGuide() would write for the day,
+ *        OR a relevant error message will be output.
+ * REMARKS: The input is read and indexed by day once, and the titles are
+ *          ranked once, rather than once for each day. Each day is then
+ *          sorted the same as outputGuide() would sort it, so the files
+ *          match those of seven runs. Days are written in order, stopping
+ *          at the first that fails. The screen only gets a line per file,
+ *          as a week is too long to read there. */
+
+int outputWeek( Options *options, TVEntry *array, int arraySize,
+                    TitlePool *titles, char *sortType )
+{
+    int success, dayCode, length;
+    int byName = ( strncmp( sortType, "name", SORT_SIZE ) == 0 );
+    long size;
+    char *text, *filename;
+    TVEntry *segment;
+    DayIndex index;
+
+    success = indexDays( array, arraySize, &index );
+    if ( ( success ) && ( byName ) )
+    {
+        success = rankNames( options, titles );
+    }
+
+    for ( dayCode = 1; ( dayCode <= DAYS_PER_WEEK ) && ( success ); dayCode++ )
+    {
+        text = NULL;
+        filename = NULL;
+        segment = daySegment( array, &index, dayCode, &length );
+
+        success = ( byName ) ? sortRanked( options, segment, length, titles ) :
+                                sortByTime( segment, length );
+        success = ( success ) &&
+                    ( formatGuide( segment, length, titles, &text, &size ) ) &&
+                    ( suffixFilename( options->outputFile,
+                                        getDayName( dayCode ), &filename ) ) &&
+                    ( writeText( filename, text, size ) );
+
+        if ( success )
+        {
+            printf( "%s: %d TV shows written to %s\n", getDayName( dayCode ),
+                        length, filename );
+        }
+        free( text );
+        free( filename );
+    }
+
+    return success;
+}
+
+
+
+
+/* NAME: outputBatch
+ * PURPOSE: Answer every query of the user's query file, writing each to a
+ *          file.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ TVEntry* ] array: the entries read from the input file
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: options->queryFile is the name of a file of queries.
+ *  POST: Each query's file holds what outputGuide() would write for its day
+ *        and sort, OR a relevant error message will be output.
+ * REMARKS: Each line of the file is "DAY SORT", such as "monday name", with
+ *          the file to write to after it, or the output file given on the
+ *          CL with the day and sort added, such as output_monday_name.txt.
+ *          Blank lines and lines starting with # are skipped. The entries
+ *          are indexed by day once, and each day is sorted and formatted in
+ *          each sort the first time it is asked for, so any amount of
+ *          queries needs at most 14 sorts, and after those only writing.
+ *          Queries are answered in order, stopping at the first that
+ *          fails. */
+
+int outputBatch( Options *options, TVEntry *array, int arraySize,
+                    TitlePool *titles )
+{
+    int success = TRUE, lineNumber = 0, dayCode, sort, complete;
+    char line[QUERY_LINE_SIZE], suffix[DAY_SIZE + SORT_SIZE + 1];
+    char *output, *filename;
+    FormattedDays days;
+    FILE *queries;
+
+    days.array = array;
+    days.titles = titles;
+    days.ranked = FALSE;
+    for ( dayCode = 1; dayCode <= DAYS_PER_WEEK; dayCode++ )
+    {
+        for ( sort = 0; sort < SORTED_TYPES; sort++ )
+        {
+            days.text[dayCode - 1][sort] = NULL;
+        }
+    }
+
+    queries = fopen( options->queryFile, "r" );
+    /* queries is NULL when it errors out */
+    if ( queries == NULL )
+    {
+        perror( "Error reading file" );
+        success = FALSE;
+    }
+    else
+    {
+        success = indexDays( array, arraySize, &days.index );
+    }
+
+    while ( ( success ) &&
+            ( fgets( line, QUERY_LINE_SIZE, queries ) != NULL ) )
+    {
+        lineNumber++;
+        filename = NULL;
+        complete = ( strchr( line, '\n' ) != NULL ) || ( feof( queries ) );
+
+        if ( ( complete ) &&
+                ( ( line[strspn( line, QUERY_SPACE )] == '\0' ) ||
+                    ( line[strspn( line, QUERY_SPACE )] == '#' ) ) )
+        {
+            /* a blank line or a comment, so there is no query */
+        }
+        else if ( ( !complete ) ||
+                    ( !parseQuery( line, &dayCode, &sort, &output ) ) )
+        {
+            fprintf( stderr, "Error: Line %d of %s is not a query, such as "
+                "\"monday name\" or \"friday time friday.txt\"\n",
+                lineNumber, options->queryFile );
+            success = FALSE;
+        }
+        else
+        {
+            sprintf( suffix, "%s_%s", getDayName( dayCode ),
+                        ( sort == SORTED_NAME ) ? "name" : "time" );
+
+            success = ( formatDay( options, &days, dayCode, sort ) ) &&
+                        ( ( output != NULL ) ||
+                            ( suffixFilename( options->outputFile, suffix,
+                                                &filename ) ) ) &&
+                        ( writeText( ( output != NULL ) ? output : filename,
+                                        days.text[dayCode - 1][sort],
+                                        days.size[dayCode - 1][sort] ) );
+
+            if ( success )
             {
-                /* copy LL to a dynamically allocated array, as required*/
-                copyToArray( list, array );
-
-                /* the comparison function is dependent on what sortType
-                 * was selected */
-                if ( strncmp( sortType, "name", SORT_SIZE ) == 0 )
-                {
-                    compare = &compareByName;
-                }
-                else
-                {
-                    compare = &compareByTime;
-                }
-
-                qsort( ( void* )array, arraySize, 
-                            sizeof ( TVEntry ), compare );
-
-                /* arraySize is updated by filter(), as it shuffles
-                 * elements forwards. This is done in place of
-                 * reallocation (mentioned later in documentation) */
-                arraySize = filter( array, day, arraySize );
-
-                outputArray( array, arraySize );
-
-                /* if writing returns an error (0), set approp. status */
-                if ( !writeFile( argv[2], array, arraySize ) )
-                {
-                    success = FALSE;
-                }
-
-                free( array ); /* IO done, so array can be free'd */
+                printf( "%s: %d TV shows written to %s\n", suffix,
+                            days.index.start[dayCode] -
+                            days.index.start[dayCode - 1],
+                            ( output != NULL ) ? output : filename );
             }
         }
-        else /* i.e. file read was unsuccessful */
+        free( filename );
+    }
+
+    if ( queries != NULL )
+    {
+        if ( ferror( queries ) )
         {
-            /* removes and frees list elements, then frees the list */
-            clear( list );
-            free( list );
-            list = NULL;
+            perror( "Error while reading from file" );
             success = FALSE;
         }
-        array = NULL; /* set the array to NULL after its unallocated */
+        fclose( queries );
     }
 
+    freeFormattedDays( &days );
     return success;
 }
 
 
 
 
-/* NAME: copyToArray
- * PURPOSE: Take a list and copy it to a given array of type TVEntry*,
- *          removing and freeing the list as it does so.
- * IMPORTS: [ LinkedList* ] list: the linked list created in main()
- *          [ TVEntry* ] array: the array dynamically created in main()
+/* NAME: parseQuery
+ * PURPOSE: Read the day, sort and output file of a line of a query file.
+ * IMPORTS: [ char [] ] line: the line, which is split up into words
+ *          [ int* ] dayCode: where to store the day, as given by getDay()
+ *          [ int* ] sort: where to store SORTED_TIME or SORTED_NAME
+ *          [ char** ] output: where to store the file to write to, which
+ *          is in line, or NULL when the line does not give one
+ * EXPORTS: [ int ] valid: validity of the line
+ *          FALSE is used for invalid, TRUE for valid
+ * ASSERTIONS
+ *  PRE: line is a null-terminated line of a query file.
+ *  POST: dayCode, sort and output are set OR valid is FALSE.
+ * REMARKS: The day and sort are in any case, the same as when they are
+ *          typed in. Words are split by strtok(), so an output file can not
+ *          have spaces in its name. */
+
+int parseQuery( char line[], int *dayCode, int *sort, char **output )
+{
+    int valid;
+    char *day, *sortType;
+
+    day = strtok( line, QUERY_SPACE );
+    sortType = strtok( NULL, QUERY_SPACE );
+    *output = strtok( NULL, QUERY_SPACE );
+
+    /* there must be a day and a sort, and nothing after the output */
+    valid = ( day != NULL ) && ( sortType != NULL ) &&
+                ( strtok( NULL, QUERY_SPACE ) == NULL );
+    if ( valid )
+    {
+        makeLower( day );
+        makeLower( sortType );
+        *dayCode = getDay( day );
+        *sort = ( strcmp( sortType, "name" ) == 0 ) ? SORTED_NAME :
+                                                        SORTED_TIME;
+        valid = ( *dayCode != 0 ) && ( ( *sort == SORTED_NAME ) ||
+                                    ( strcmp( sortType, "time" ) == 0 ) );
+    }
+    return valid;
+}
+
+
+
+
+/* NAME: formatDay
+ * PURPOSE: Sort and format the entries of a day in a sort, only the first
+ *          time they are asked for.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ FormattedDays* ] days: the days formatted so far
+ *          [ int ] dayCode: the day, as given by getDay()
+ *          [ int ] sort: SORTED_TIME or SORTED_NAME
  * EXPORTS: [ int ] success: success or failure of the function
  *          FALSE (0) is used for failure, TRUE (!0) is used for success
  * ASSERTIONS
- *  PRE: List contains a valid linked list
- *  POST: Array contains all linked list values, and List is empty and freed
- * REMARKS: clear( list ) is redundant, but is acts as a backup if the length
- * count is ever off or something could not be removed. */
+ *  PRE: days->index was built by indexDays(). dayCode is between 1-7.
+ *  POST: days holds the day's guide in the sort, the same as outputGuide()
+ *        would write it, OR an error is output.
+ * REMARKS: The day's entries are sorted in a copy, so the array is left
+ *          indexed by day for the other sort, and the copy is released
+ *          once it is formatted. The titles are ranked by the first sort by
+ *          name, and every other day sorted by name is given the same
+ *          ranks. */
 
-int copyToArray( LinkedList *list, TVEntry *array )
+int formatDay( Options *options, FormattedDays *days, int dayCode, int sort )
 {
-    int success = TRUE, ii = 0;
+    int success = TRUE, length;
+    TVEntry *day, *sorted;
 
-    /* loops through all list elements, unless failure occurs */
-    while ( ( !isEmpty( list ) ) && ( success ) )
+    if ( days->text[dayCode - 1][sort] == NULL )
     {
-        /* entry is the element at the top of the stack
-         * which is copied to the array
-         * and then freed (as it was not freed in removeFirst()) */
-        TVEntry *entry = ( TVEntry* )removeFirst( list );
-        if ( entry == NULL )
+        day = daySegment( days->array, &days->index, dayCode, &length );
+
+        /* +1 so an empty day still gets its own block */
+        sorted = ( TVEntry* )malloc( ( size_t )( length + 1 ) *
+                                        sizeof ( TVEntry ) );
+        if ( sorted == NULL )
         {
-            fprintf( stderr, "Error: Value could not be removed!\n" );
+            fprintf( stderr, "Error: Memory not assigned!\n" );
             success = FALSE;
         }
-        else
+        else if ( length > 0 )
         {
-            array[ii] = *entry;
-            free( entry );
-            ii++;
+            memcpy( sorted, day, ( size_t )length * sizeof ( TVEntry ) );
         }
-    }
 
-    clear( list ); /* redundant, but helps if length count is ever off */
-    free ( list ); /* free the list structure itself */
-    list = NULL; /* and set the variable to NULL as is good practice */
+        if ( ( success ) && ( sort == SORTED_NAME ) && ( !days->ranked ) )
+        {
+            success = rankNames( options, days->titles );
+            days->ranked = success;
+        }
+
+        if ( success )
+        {
+            success = ( sort == SORTED_NAME ) ?
+                sortRanked( options, sorted, length, days->titles ) :
+                sortByTime( sorted, length );
+        }
 
+        /* the text is left NULL if formatting fails */
+        success = ( success ) &&
+                    ( formatGuide( sorted, length, days->titles,
+                                    &days->text[dayCode - 1][sort],
+                                    &days->size[dayCode - 1][sort] ) );
+        free( sorted );
+    }
     return success;
 }
 
 
 
 
-/* NAME: filter
- * PURPOSE: Take an array and filter the array so that only the day the user
- *          selected is present in the array.
- * IMPORTS: [ TVEntry* ] array: the array dynamically created in main()
- *          [ char* ] day: string with the user's choice of day for filtering
- *          [ int ] arraySize: the size of the array passed
- * EXPORTS: [ int ] jj: a counter for the amount of array indexes that match
- *                      the desired filter; effectively becomes the new array
- *                      size in main()
+/* NAME: freeFormattedDays
+ * PURPOSE: Release every formatted day held.
+ * IMPORTS: [ FormattedDays* ] days: the days to release
+ * EXPORTS: void
  * ASSERTIONS
- *  PRE: arraySize is the size of the array
- *       day contains a valid day of the week
- *       array is not empty 
- *  POST: jj will represent the new arraySize
- *        array will contain the filtered selection
- * REMARKS: I could have used realloc() instead, but there is no certainty 
- * that the function would free() the memory to the OS (but rather for future
- * malloc uses (which are not present in this program), and thus the realloc 
- * has no real benefit as the array is free'd shortly after this function.
- * See: https://stackoverflow.com/a/26226613, 2014; M.M's answer */
-
-int filter( TVEntry *array, char *day, int arraySize )
+ *  PRE: days had every text set to NULL before it was used.
+ *  POST: days holds no formatted days.
+ * REMARKS: The array and titles are not freed, as they are not owned. */
+
+void freeFormattedDays( FormattedDays *days )
 {
-    int jj = 0;
-    int ii;
+    int ii, jj;
 
-    /* go through the entire array */
-    for( ii = 0; ii < arraySize; ii++ )
+    for ( ii = 0; ii < DAYS_PER_WEEK; ii++ )
     {
-        /* and if the array's day field is the same as the day option
-         * selected by the user previously, save it to the array */
-        if ( strncmp( array[ii].day, day, DAY_SIZE ) == 0 )
+        for ( jj = 0; jj < SORTED_TYPES; jj++ )
         {
-            /* array[jj] will overwrite existing previous values
-             * by effectively copying the matching day's structure
-             * to the start of the array */
-            array[jj] = array[ii];
-            jj++; /* increment for following matches to be stored sequential*/
+            free( days->text[ii][jj] );
+            days->text[ii][jj] = NULL;
         }
     }
+}
+
+
+
+
+/* NAME: suffixFilename
+ * PURPOSE: Name a file after the output file, with a suffix added.
+ * IMPORTS: [ const char* ] outputFile: the output file given on the CL
+ *          [ const char* ] suffix: what to add, such as a day's name
+ *          [ char** ] filename: where to store the name, which is allocated
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: *filename should be given to free(), OR an error is output and
+ *        *filename is NULL.
+ * REMARKS: The suffix goes before the extension of the file's own name, so
+ *          guides/out.txt becomes guides/out_monday.txt, and a name without
+ *          an extension, such as out, becomes out_monday. */
+
+int suffixFilename( const char *outputFile, const char *suffix,
+                        char **filename )
+{
+    int success = TRUE;
+    size_t stem = strlen( outputFile );
+    const char *dot = strrchr( outputFile, '.' );
+    const char *slash = strrchr( outputFile, '/' );
+
+    /* a dot before the last slash is in a directory, not the extension,
+     * and a dot starting the name is a hidden file, not one either */
+    if ( ( dot != NULL ) && ( dot != outputFile ) &&
+            ( ( slash == NULL ) || ( dot > slash + 1 ) ) )
+    {
+        stem = ( size_t )( dot - outputFile );
+    }
+
+    *filename = ( char* )malloc( strlen( outputFile ) + strlen( suffix ) +
+                                    2 );
+    if ( *filename == NULL )
+    {
+        fprintf( stderr, "Error: Memory not assigned!\n" );
+        success = FALSE;
+    }
+    else
+    {
+        memcpy( *filename, outputFile, stem );
+        sprintf( *filename + stem, "_%s%s", suffix, outputFile + stem );
+    }
+    return success;
+}
+
+
 
-    
 
-    return jj;
+/* NAME: sortNames
+ * PURPOSE: Sort an array of entries by name, with the engine and threads
+ *          the user asked for.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ TVEntry* ] array: the entries to sort
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array.
+ *  POST: array is sorted by name OR an error is output.
+ * REMARKS: The titles are ranked first either way, by the radix engine
+ *          with -r, which then counting sorts the entries by rank, or by
+ *          qsort(), which leaves parallelSort() comparing ranks. */
+
+int sortNames( Options *options, TVEntry *array, int arraySize,
+                TitlePool *titles )
+{
+    return ( rankNames( options, titles ) ) &&
+            ( sortRanked( options, array, arraySize, titles ) );
+}
+
+
+
+
+/* NAME: rankNames
+ * PURPOSE: Rank the titles of a pool in name order, with the engine the
+ *          user asked for.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ TitlePool* ] titles: the pool to rank
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: N/A
+ *  POST: titles->rank holds every title's rank, and is what compareByName()
+ *        compares, OR an error is output.
+ * REMARKS: Ranking replaces titles->rank, so compareByName() is given it
+ *          again every time. */
+
+int rankNames( Options *options, TitlePool *titles )
+{
+    int success;
+
+    success = rankTitles( titles, ( options->radix ) ? RANK_RADIX :
+                                                        RANK_QSORT );
+    if ( success )
+    {
+        setTitleRank( titles->rank );
+    }
+    return success;
+}
+
+
+
+
+/* NAME: sortRanked
+ * PURPOSE: Sort an array of entries by the ranks of their titles, with the
+ *          engine and threads the user asked for.
+ * IMPORTS: [ Options* ] options: the settings from the CL arguments
+ *          [ TVEntry* ] array: the entries to sort
+ *          [ int ] arraySize: the size of the array passed
+ *          [ TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: arraySize is the size of the array. The titles were ranked by
+ *       rankNames().
+ *  POST: array is sorted by name OR an error is output.
+ * REMARKS: The ranks are left as they are, so the same ranks can sort any
+ *          amount of arrays. The radix engine's counting sort runs on one
+ *          thread, which is why parseOptions() does not take -p with -r. */
+
+int sortRanked( Options *options, TVEntry *array, int arraySize,
+                TitlePool *titles )
+{
+    int success;
+
+    if ( options->radix )
+    {
+        success = sortByRank( array, arraySize, titles->rank,
+                                titles->count );
+    }
+    else
+    {
+        success = parallelSort( array, arraySize, &compareByName,
+                                    options->sortThreads );
+    }
+    return success;
 }
@@ -0,0 +1,199 @@
+/* FILE: vector.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Contains all functions that implement the Vector structure.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: Elements are copied in and out by size, so a Vector can hold any
+ *           type, the same as the linked list it replaced could with its
+ *           void pointers.
+ */
+
+
+#include "vector.h"
+
+
+/* room for the first elements, so small vectors do not grow many times */
+#define VECTOR_START 64
+
+
+
+
+/* NAME: initVector
+ * PURPOSE: Set up a vector that holds no elements.
+ * IMPORTS: [ Vector* ] vector: the vector to set up
+ *          [ size_t ] elementSize: the size of each element in bytes
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: elementSize is greater than 0.
+ *  POST: vector is empty, and nothing has been allocated for it yet.
+ * REMARKS: None */
+
+void initVector( Vector *vector, size_t elementSize )
+{
+    vector->data = NULL;
+    vector->elementSize = elementSize;
+    vector->length = 0;
+    vector->capacity = 0;
+    vector->grows = 0;
+}
+
+
+
+
+/* NAME: reserveVector
+ * PURPOSE: Make sure a vector has room for some amount of elements, so they
+ *          can be added without it growing again.
+ * IMPORTS: [ Vector* ] vector: the vector to make room in
+ *          [ int ] capacity: the amount of elements to have room for
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: vector was set up with initVector().
+ *  POST: vector has room for capacity elements OR it is left unchanged.
+ * REMARKS: Never shrinks the vector. Nothing is output on failure, the
+ *          caller outputs the error. */
+
+int reserveVector( Vector *vector, int capacity )
+{
+    int success = TRUE;
+    void *grown;
+
+    if ( capacity > vector->capacity )
+    {
+        grown = realloc( vector->data, ( size_t )capacity *
+                                            vector->elementSize );
+        if ( grown == NULL )
+        {
+            success = FALSE;
+        }
+        else
+        {
+            vector->data = grown;
+            vector->capacity = capacity;
+            vector->grows++;
+        }
+    }
+    return success;
+}
+
+
+
+
+/* NAME: pushVector
+ * PURPOSE: Add an element to the back of a vector.
+ * IMPORTS: [ Vector* ] vector: the vector to add to
+ *          [ const void* ] value: the element to copy into the vector
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: vector was set up with initVector(). value points to elementSize
+ *       bytes.
+ *  POST: value is copied to the back of the vector OR it is left unchanged.
+ * REMARKS: The capacity doubles when full, so adding n elements only moves
+ *          them O(log n) times, making each push O(1) amortised. */
+
+int pushVector( Vector *vector, const void *value )
+{
+    int success = TRUE;
+
+    if ( vector->length == vector->capacity )
+    {
+        success = reserveVector( vector, ( vector->capacity == 0 ) ?
+                                    VECTOR_START : vector->capacity * 2 );
+    }
+
+    if ( success )
+    {
+        memcpy( ( char* )vector->data + ( size_t )vector->length *
+                    vector->elementSize, value, vector->elementSize );
+        vector->length++;
+    }
+    return success;
+}
+
+
+
+
+/* NAME: appendVector
+ * PURPOSE: Add several elements to the back of a vector at once.
+ * IMPORTS: [ Vector* ] vector: the vector to add to
+ *          [ const void* ] values: the elements to copy into the vector
+ *          [ int ] count: the amount of elements in values
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: vector was set up with initVector(). values points to count
+ *       elements.
+ *  POST: values are copied to the back of the vector OR it is left
+ *        unchanged.
+ * REMARKS: Grows the vector at most once, then copies every element in one
+ *          go, rather than pushing them one at a time. */
+
+int appendVector( Vector *vector, const void *values, int count )
+{
+    int success = TRUE, capacity = vector->capacity;
+
+    if ( vector->length + count > capacity )
+    {
+        capacity = ( capacity == 0 ) ? VECTOR_START : capacity;
+        while ( capacity < vector->length + count )
+        {
+            capacity *= 2;
+        }
+        success = reserveVector( vector, capacity );
+    }
+
+    if ( ( success ) && ( count > 0 ) )
+    {
+        memcpy( ( char* )vector->data + ( size_t )vector->length *
+                    vector->elementSize, values,
+                    ( size_t )count * vector->elementSize );
+        vector->length += count;
+    }
+    return success;
+}
+
+
+
+
+/* NAME: releaseVector
+ * PURPOSE: Hand the elements of a vector off to the caller, as an array.
+ * IMPORTS: [ Vector* ] vector: the vector to take the elements from
+ * EXPORTS: [ void* ] data: the array of elements, which is vector->length
+ *          long before the call, or NULL if there were none
+ * ASSERTIONS
+ *  PRE: vector was set up with initVector().
+ *  POST: vector is empty, and the caller must free() data.
+ * REMARKS: No elements are copied, the vector's own memory is given away. */
+
+void* releaseVector( Vector *vector )
+{
+    void *data = vector->data;
+
+    vector->data = NULL;
+    vector->length = 0;
+    vector->capacity = 0;
+    return data;
+}
+
+
+
+
+/* NAME: freeVector
+ * PURPOSE: Release the elements held by a vector.
+ * IMPORTS: [ Vector* ] vector: the vector to release
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: vector was set up with initVector().
+ *  POST: vector is empty.
+ * REMARKS: Safe to call on a vector that has already been freed or
+ *          released. */
+
+void freeVector( Vector *vector )
+{
+    free( vector->data );
+    vector->data = NULL;
+    vector->length = 0;
+    vector->capacity = 0;
+}
@@ -0,0 +1,54 @@
+/* FILE: vector.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, typedefs, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef VECTOR_H
+#define VECTOR_H
+
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "boolean.h"
+
+
+/* NAME: Vector
+ * PURPOSE: Act as a growable array, which holds its elements one after the
+ *          other in a single block of memory, unlike the linked list it
+ *          replaced, which allocated a node per element.
+ * FIELDS:  [ void* ] data: the elements, NULL until the first is added
+ *          [ size_t ] elementSize: the size of each element in bytes
+ *          [ int ] length: the amount of elements held
+ *          [ int ] capacity: the amount of elements data has room for
+ *          [ unsigned long ] grows: the amount of times data was allocated
+ *          or moved to grow it
+ * REMARKS: Start with initVector() and release with freeVector(), unless
+ *          releaseVector() has handed the elements off to the caller. */
+
+typedef struct
+{
+    void *data;
+    size_t elementSize;
+    int length;
+    int capacity;
+    unsigned long grows;
+} Vector;
+
+
+void initVector( Vector *vector, size_t elementSize );
+int reserveVector( Vector *vector, int capacity );
+int pushVector( Vector *vector, const void *value );
+int appendVector( Vector *vector, const void *values, int count );
+void* releaseVector( Vector *vector );
+void freeVector( Vector *vector );
+
+
+
+#endif
@@ -0,0 +1,344 @@
+/* FILE: writer.c
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: Output the guide to screen and file on threads of their own,
+ *          while the next part of it is still being formatted.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: Uses POSIX pthreads, open() and write() rather than C89
+ *           functions, so _POSIX_C_SOURCE is defined before any includes.
+ */
+
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "writer.h"
+
+
+/* the screen and the file */
+#define WRITER_SINKS 2
+
+
+/* NAME: OutputRing
+ * PURPOSE: Hold the buffers chunks of the guide are formatted into, and
+ *          how far each sink has got through them.
+ * FIELDS:  [ char* ] text: array indexed by buffer of its chars
+ *          [ long ] capacity: array indexed by buffer of how many chars it
+ *          has room for
+ *          [ long ] size: array indexed by buffer of how many chars of the
+ *          chunk in it are to be written
+ *          [ int ] pending: array indexed by buffer of how many sinks are
+ *          yet to write the chunk in it, so 0 once it can be reused
+ *          [ int ] filled: the amount of chunks formatted so far
+ *          [ int ] done: TRUE once no more chunks will be formatted
+ *          [ pthread_mutex_t ] lock: held while reading or changing pending,
+ *          filled or done
+ *          [ pthread_cond_t ] changed: signalled whenever they change
+ * REMARKS: Private to this file. Chunk c goes in buffer c % WRITER_BUFFERS,
+ *          so while one buffer is being written the next is formatted. */
+
+typedef struct {
+    char *text[WRITER_BUFFERS];
+    long capacity[WRITER_BUFFERS];
+    long size[WRITER_BUFFERS];
+    int pending[WRITER_BUFFERS];
+    int filled;
+    int done;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+} OutputRing;
+
+
+/* NAME: OutputSink
+ * PURPOSE: Hold where one copy of the guide is written to.
+ * FIELDS:  [ OutputRing* ] ring: the chunks to write
+ *          [ int ] fd: the file descriptor to write them to
+ *          [ int ] written: the amount of chunks written so far
+ *          [ int ] failed: TRUE once a write has failed
+ *          [ int ] error: the errno of the write that failed
+ *          [ int ] threaded: TRUE if the sink was given a thread of its own
+ * REMARKS: Private to this file. A sink that has failed still takes every
+ *          chunk, without writing it, so the other sink is not held up. */
+
+typedef struct {
+    OutputRing *ring;
+    int fd;
+    int written;
+    int failed;
+    int error;
+    int threaded;
+} OutputSink;
+
+
+static void* drainSink( void *arg );
+static void drainChunk( OutputSink *sink );
+
+
+
+
+/* NAME: writeGuideAsync
+ * PURPOSE: Output an array to screen and write it to a file, formatting
+ *          each chunk of it while the one before is being written.
+ * IMPORTS: [ char [] ] filename: file to write to
+ *          [ TVEntry* ] array: array of TVEntry structure to output
+ *          [ int ] arraySize : the size of array
+ *          [ const TitlePool* ] titles: the pool the titles of array are
+ *          interned in
+ *          [ const char* ] empty: the message to output when array is
+ *          empty, EMPTY_DAY or EMPTY_QUERY
+ * EXPORTS: [ int ] success: success or failure of the function
+ *          FALSE (0) is used for failure, TRUE (!0) is used for success
+ * ASSERTIONS
+ *  PRE: filename is to be written to. arraySize is the size of the array.
+ *  POST: The array is output to screen and written to file, the same as
+ *        writeGuide() would, OR an error is output.
+ * REMARKS: This thread formats WRITER_CHUNK entries at a time into the
+ *          buffers of a ring, and the screen and the file each have a
+ *          thread writing every chunk, so both are written at once and
+ *          neither waits for the whole guide to be formatted. A buffer is
+ *          only reused once both have written it. A sink that can not get
+ *          a thread is written to by this thread after each chunk, so the
+ *          guide is still written, just without the overlap. */
+
+int writeGuideAsync( char filename[], TVEntry *array, int arraySize,
+                        const TitlePool *titles, const char *empty )
+{
+    int success = TRUE, assigned = TRUE, fd = -1, count = 0, chunk, buffer;
+    int length, ii, openError = 0;
+    long size;
+    char *grown;
+    OutputRing ring;
+    OutputSink sinks[WRITER_SINKS];
+    pthread_t workers[WRITER_SINKS];
+
+    for ( buffer = 0; buffer < WRITER_BUFFERS; buffer++ )
+    {
+        ring.text[buffer] = NULL;
+        ring.capacity[buffer] = 0;
+        ring.size[buffer] = 0;
+        ring.pending[buffer] = 0;
+    }
+    ring.filled = 0;
+    ring.done = FALSE;
+    pthread_mutex_init( &ring.lock, NULL );
+    pthread_cond_init( &ring.changed, NULL );
+
+    /* the screen gets the same blank lines and message writeGuide() gives,
+     * but a screen that can not be written to is not an error, as before */
+    fflush( stdout );
+    writeAll( STDOUT_FILENO, "\n\n", 2 );
+    if ( arraySize == 0 )
+    {
+        fprintf( stderr, "%s\n", empty );
+    }
+    else
+    {
+        sinks[count].fd = STDOUT_FILENO;
+        count++;
+    }
+
+    fd = open( filename, O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+    /* fd is -1 when it errors out, which is output once the screen has
+     * been written, the same as writeGuide() */
+    if ( fd == -1 )
+    {
+        openError = errno;
+        success = FALSE;
+    }
+    else
+    {
+        sinks[count].fd = fd;
+        count++;
+    }
+
+    for ( ii = 0; ii < count; ii++ )
+    {
+        sinks[ii].ring = &ring;
+        sinks[ii].written = 0;
+        sinks[ii].failed = FALSE;
+        sinks[ii].error = 0;
+        sinks[ii].threaded = ( pthread_create( &workers[ii], NULL,
+                                                drainSink, &sinks[ii] ) == 0 );
+    }
+
+    /* formatting stops on running out of memory, but the sinks still write
+     * the chunks they were given */
+    for ( chunk = 0; ( chunk * WRITER_CHUNK < arraySize ) && ( count > 0 ) &&
+            ( assigned ); chunk++ )
+    {
+        buffer = chunk % WRITER_BUFFERS;
+        length = arraySize - chunk * WRITER_CHUNK;
+        if ( length > WRITER_CHUNK )
+        {
+            length = WRITER_CHUNK;
+        }
+
+        pthread_mutex_lock( &ring.lock );
+        while ( ring.pending[buffer] > 0 )
+        {
+            pthread_cond_wait( &ring.changed, &ring.lock );
+        }
+        pthread_mutex_unlock( &ring.lock );
+
+        size = measureGuide( array + chunk * WRITER_CHUNK, length, titles );
+        if ( size > ring.capacity[buffer] )
+        {
+            grown = ( char* )realloc( ring.text[buffer], ( size_t )size + 1 );
+            if ( grown == NULL )
+            {
+                fprintf( stderr, "Error: Memory not assigned!\n" );
+                success = FALSE;
+                assigned = FALSE;
+            }
+            else
+            {
+                ring.text[buffer] = grown;
+                ring.capacity[buffer] = size;
+            }
+        }
+
+        if ( assigned )
+        {
+            fillGuide( array + chunk * WRITER_CHUNK, length, titles,
+                        ring.text[buffer], PREFIX_TABLE );
+
+            pthread_mutex_lock( &ring.lock );
+            ring.size[buffer] = size;
+            ring.pending[buffer] = count;
+            ring.filled++;
+            pthread_cond_broadcast( &ring.changed );
+            pthread_mutex_unlock( &ring.lock );
+
+            for ( ii = 0; ii < count; ii++ )
+            {
+                if ( !sinks[ii].threaded )
+                {
+                    drainChunk( &sinks[ii] );
+                }
+            }
+        }
+    }
+
+    pthread_mutex_lock( &ring.lock );
+    ring.done = TRUE;
+    pthread_cond_broadcast( &ring.changed );
+    pthread_mutex_unlock( &ring.lock );
+
+    for ( ii = 0; ii < count; ii++ )
+    {
+        if ( sinks[ii].threaded )
+        {
+            pthread_join( workers[ii], NULL );
+        }
+    }
+
+    if ( fd == -1 )
+    {
+        errno = openError;
+        perror( "Error writing file" );
+    }
+    else
+    {
+        /* the file is always the last sink */
+        if ( sinks[count - 1].failed )
+        {
+            errno = sinks[count - 1].error;
+            perror( "Error while writing from file" );
+            success = FALSE;
+        }
+
+        if ( close( fd ) == -1 )
+        {
+            perror( "Error while writing from file" );
+            success = FALSE;
+        }
+    }
+
+    for ( buffer = 0; buffer < WRITER_BUFFERS; buffer++ )
+    {
+        free( ring.text[buffer] );
+    }
+    pthread_cond_destroy( &ring.changed );
+    pthread_mutex_destroy( &ring.lock );
+    return success;
+}
+
+
+
+
+/* NAME: drainSink
+ * PURPOSE: Write every chunk of a ring to a sink, until no more are coming.
+ * IMPORTS: [ void* ] arg: the OutputSink to write to
+ * EXPORTS: [ void* ] result: always NULL
+ * ASSERTIONS
+ *  PRE: arg points to an OutputSink with every field set.
+ *  POST: Every chunk formatted has been written, or skipped once a write
+ *        failed.
+ * REMARKS: Private to this file. Has the signature of a pthread start
+ *          routine so it can be run on a thread of its own. Waits on the
+ *          ring while it has written every chunk formatted so far. */
+
+void* drainSink( void *arg )
+{
+    OutputSink *sink = ( OutputSink* )arg;
+    OutputRing *ring = sink->ring;
+    int finished = FALSE;
+
+    while ( !finished )
+    {
+        pthread_mutex_lock( &ring->lock );
+        while ( ( sink->written == ring->filled ) && ( !ring->done ) )
+        {
+            pthread_cond_wait( &ring->changed, &ring->lock );
+        }
+        finished = ( sink->written == ring->filled );
+        pthread_mutex_unlock( &ring->lock );
+
+        if ( !finished )
+        {
+            drainChunk( sink );
+        }
+    }
+    return NULL;
+}
+
+
+
+
+/* NAME: drainChunk
+ * PURPOSE: Write the next chunk of a ring to a sink, and hand its buffer
+ *          back once every sink has written it.
+ * IMPORTS: [ OutputSink* ] sink: the sink to write to
+ * EXPORTS: void
+ * ASSERTIONS
+ *  PRE: The sink's next chunk has been formatted.
+ *  POST: The chunk has been written, or skipped once a write failed, and
+ *        the sink moves on to the next chunk.
+ * REMARKS: Private to this file. The buffer is written without holding the
+ *          lock, as it is not changed until its pending count is 0. */
+
+void drainChunk( OutputSink *sink )
+{
+    OutputRing *ring = sink->ring;
+    int buffer = sink->written % WRITER_BUFFERS;
+
+    if ( ( !sink->failed ) &&
+            ( !writeAll( sink->fd, ring->text[buffer], ring->size[buffer] ) ) )
+    {
+        sink->failed = TRUE;
+        sink->error = errno;
+    }
+
+    pthread_mutex_lock( &ring->lock );
+    sink->written++;
+    ring->pending[buffer]--;
+    pthread_cond_broadcast( &ring->changed );
+    pthread_mutex_unlock( &ring->lock );
+}
@@ -0,0 +1,37 @@
+/* FILE: writer.h
+ * AUTHOR: Cameron Petkov
+ * UNIT: Unix and C Programming
+ * PURPOSE: General header includes, definitions, and forward-declarations.
+ * REFERENCE: N/A
+ * LAST MOD: 17/10/2026
+ * COMMENTS: None
+ */
+
+
+#ifndef WRITER_H
+#define WRITER_H
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "data.h"
+#include "io.h"
+#include "titlePool.h"
+#include "boolean.h"
+
+
+/* the amount of chunks that can be formatted or written at once, and the
+ * amount of entries formatted into each */
+#define WRITER_BUFFERS 2
+#define WRITER_CHUNK 8192
+
+
+int writeGuideAsync( char filename[], TVEntry *array, int arraySize,
+                        const TitlePool *titles, const char *empty );
+
+
+
+#endif